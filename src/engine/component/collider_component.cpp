@@ -1,5 +1,6 @@
 #include "collider_component.h"
 #include "transform_component.h"
+#include "physics_component.h"
 #include "../object/game_object.h"
 #include "../physics/collider.h"
 #include <spdlog/spdlog.h>
@@ -39,6 +40,12 @@ namespace engine::component
 
         // 在获取 transform_ 之后计算初始偏移量
         updateOffset();
+
+        // 如果物理组件先于碰撞组件添加，需要通知它更新缓存的碰撞组件
+        if (auto *pc = owner_->getComponent<PhysicsComponent>(); pc)
+        {
+            pc->refreshCachedComponents();
+        }
     }
 
     // 实现 setAlignment 方法
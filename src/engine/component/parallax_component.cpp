@@ -5,7 +5,12 @@
 #include "../render/sprite.h"
 #include "../object/game_object.h"
 #include "../core/context.h"
+#include "../resource/resource_manager.h"
+#include <SDL3/SDL_render.h>
 #include <spdlog/spdlog.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace engine::component
 {
@@ -37,8 +42,103 @@ namespace engine::component
         {
             return;
         }
+        // 首次绘制时解析纹理句柄
+        if (!sprite_.getTextureHandle().isValid())
+        {
+            sprite_.setTextureHandle(context.getResourceManager().getTextureHandle(sprite_.getTextureId()));
+        }
+        // 重复的图层绘制预先拼接的条带，条带不可用时逐块绘制
+        if (updateStrip(context))
+        {
+            context.getRenderer().drawParallaxTexture(context.getCamera(), strip_.get(), transform_->getPosition(), scroll_factor_, repeat_, strip_tile_size_);
+            return;
+        }
         // 直接调用视差滚动绘制函数
         context.getRenderer().drawParallax(context.getCamera(), sprite_, transform_->getPosition(), scroll_factor_, repeat_, transform_->getScale());
     }
 
+    void ParallaxComponent::clean()
+    {
+        strip_.reset(); // 条带纹理需要在渲染器销毁之前释放
+    }
+
+    void ParallaxComponent::setSprite(const engine::render::Sprite &sprite)
+    {
+        sprite_ = sprite;
+        strip_.reset();
+        strip_enabled_ = true;
+    }
+
+    void ParallaxComponent::setRepeat(glm::bvec2 repeat)
+    {
+        repeat_ = std::move(repeat);
+        strip_.reset();
+        strip_enabled_ = true;
+    }
+
+    void ParallaxComponent::StripTextureDeleter::operator()(SDL_Texture *texture) const
+    {
+        if (texture)
+        {
+            SDL_DestroyTexture(texture);
+        }
+    }
+
+    bool ParallaxComponent::updateStrip(engine::core::Context &context)
+    {
+        // 只拼接整张纹理重复的图层（与 drawParallax 一致，有源矩形的精灵不使用条带）
+        if (!strip_enabled_ || (!repeat_.x && !repeat_.y) || sprite_.getSourceRect().has_value())
+        {
+            return false;
+        }
+        glm::vec2 viewport_size = context.getCamera().getViewportSize();
+        glm::vec2 scale = transform_->getScale();
+        if (strip_ && viewport_size == strip_viewport_size_ && scale == strip_scale_)
+        {
+            return true;
+        }
+
+        auto texture_size = context.getResourceManager().getTextureSize(sprite_.getTextureHandle());
+        auto scaled_size = texture_size * scale;
+        if (scaled_size.x <= 0.0f || scaled_size.y <= 0.0f)
+        {
+            return false;
+        }
+        // 在重复方向上拼接足够多份，使条带至少覆盖一个视口，每帧最多绘制两次
+        glm::ivec2 copies = {repeat_.x ? std::max(1, static_cast<int>(std::ceil(viewport_size.x / scaled_size.x))) : 1,
+                             repeat_.y ? std::max(1, static_cast<int>(std::ceil(viewport_size.y / scaled_size.y))) : 1};
+        auto strip_size = glm::ivec2(texture_size) * copies;
+        if (strip_size.x > MAX_STRIP_SIZE || strip_size.y > MAX_STRIP_SIZE)
+        {
+            spdlog::warn("ParallaxComponent: 条带尺寸 ({}, {}) 过大，退回逐块绘制: {}", strip_size.x, strip_size.y, sprite_.getTextureId());
+            strip_.reset();
+            strip_enabled_ = false;
+            return false;
+        }
+
+        auto &renderer = context.getRenderer();
+        strip_.reset(renderer.createTargetTexture(strip_size));
+        if (!strip_ || !renderer.beginRenderToTexture(strip_.get()))
+        {
+            spdlog::warn("ParallaxComponent: 无法创建条带纹理，退回逐块绘制: {}", sprite_.getTextureId());
+            strip_.reset();
+            strip_enabled_ = false;
+            return false;
+        }
+        for (int y = 0; y < copies.y; ++y)
+        {
+            for (int x = 0; x < copies.x; ++x)
+            {
+                renderer.drawUISprite(sprite_, texture_size * glm::vec2(x, y), texture_size);
+            }
+        }
+        renderer.endRenderToTexture();
+
+        strip_tile_size_ = scaled_size * glm::vec2(copies);
+        strip_viewport_size_ = viewport_size;
+        strip_scale_ = scale;
+        spdlog::debug("ParallaxComponent: 拼接条带 {}x{} 份，纹理: {}", copies.x, copies.y, sprite_.getTextureId());
+        return true;
+    }
+
 } // namespace engine::component
\ No newline at end of file
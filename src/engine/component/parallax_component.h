@@ -2,8 +2,11 @@
 #include "component.h"
 #include "../render/sprite.h"
 #include <string>
+#include <memory>
 #include <glm/vec2.hpp>
 
+struct SDL_Texture;
+
 namespace engine::component
 {
     class TransformComponent;
@@ -12,12 +15,22 @@ namespace engine::component
      * @brief 在背景中渲染可滚动纹理的组件，以创建视差效果。
      *
      * 该组件根据相机的位置和滚动因子来移动纹理。
+     * 重复的图层会预先把纹理拼接成至少一个视口宽（高）的条带纹理，每帧每个重复方向最多绘制两次条带；
+     * 视口尺寸或缩放变化时重新拼接。
      */
     class ParallaxComponent final : public Component
     {
         friend class engine::object::GameObject;
 
     private:
+        static constexpr int MAX_STRIP_SIZE = 4096; ///< @brief 条带纹理的最大边长（像素），超过时退回逐块绘制
+
+        /// @brief 释放条带纹理的删除器
+        struct StripTextureDeleter
+        {
+            void operator()(SDL_Texture *texture) const;
+        };
+
         TransformComponent *transform_ = nullptr; ///< @brief 缓存变换组件
 
         engine::render::Sprite sprite_; ///< @brief 精灵对象
@@ -25,6 +38,12 @@ namespace engine::component
         glm::bvec2 repeat_;             ///< @brief 是否沿着X和Y轴周期性重复
         bool is_hidden_ = false;        ///< @brief 是否隐藏（不渲染）
 
+        std::unique_ptr<SDL_Texture, StripTextureDeleter> strip_; ///< @brief 预先拼接的重复条带（为空时需要重新拼接）
+        glm::vec2 strip_tile_size_ = {0.0f, 0.0f};                ///< @brief 条带绘制时的尺寸（已缩放）
+        glm::vec2 strip_viewport_size_ = {0.0f, 0.0f};            ///< @brief 拼接条带时的视口尺寸
+        glm::vec2 strip_scale_ = {0.0f, 0.0f};                    ///< @brief 拼接条带时的缩放
+        bool strip_enabled_ = true;                               ///< @brief 是否使用条带（拼接失败后退回逐块绘制）
+
     public:
         /**
          * @brief 构造函数
@@ -37,9 +56,9 @@ namespace engine::component
         ParallaxComponent(std::string_view texture_id, glm::vec2 scroll_factor, glm::bvec2 repeat);
 
         // --- 设置器 ---
-        void setSprite(const engine::render::Sprite &sprite) { sprite_ = sprite; }     ///< @brief 设置精灵对象
+        void setSprite(const engine::render::Sprite &sprite);                          ///< @brief 设置精灵对象（条带会重新拼接）
         void setScrollFactor(glm::vec2 factor) { scroll_factor_ = std::move(factor); } ///< @brief 设置滚动速度因子
-        void setRepeat(glm::bvec2 repeat) { repeat_ = std::move(repeat); }             ///< @brief 设置是否重复
+        void setRepeat(glm::bvec2 repeat);                                             ///< @brief 设置是否重复（条带会重新拼接）
         void setHidden(bool hidden) { is_hidden_ = hidden; }                           ///< @brief 设置是否隐藏（不渲染）
 
         // --- 获取器 ---
@@ -53,6 +72,14 @@ namespace engine::component
         void update(float, engine::core::Context &) override {} // 必须实现纯虚函数，留空
         void init() override;
         void render(engine::core::Context &context) override;
+        void clean() override;
+
+    private:
+        /**
+         * @brief 需要时（首次绘制、视口尺寸或缩放变化）把纹理拼接为条带。
+         * @return 条带可用时返回 true；不重复、纹理过大或创建渲染目标失败时返回 false
+         */
+        bool updateStrip(engine::core::Context &context);
     };
 
 } // namespace engine::component
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "transform_component.h"
 #include "../object/game_object.h"
 #include "../physics/physics_engine.h"
+#include "../physics/body_storage.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::component
@@ -34,15 +35,197 @@ namespace engine::component
         {
             spdlog::warn("物理组件初始化时，同一GameObject上没有找到TransformComponent组件。");
         }
-        // 注册到PhysicsEngine
+        // 注册到PhysicsEngine (注册后 body_index_ 有效，初始设置被复制到引擎的物体数组中)
         physics_engine_->registerComponent(this);
         spdlog::trace("物理组件初始化完成。");
     }
 
     void PhysicsComponent::clean()
     {
+        // 注销前保存引擎中的状态，之后的读写使用本地值
+        if (isRegistered())
+        {
+            const auto &bodies = physics_engine_->getBodyStorage();
+            enabled_ = bodies.enabled[body_index_] != 0;
+            velocity_ = bodies.velocities[body_index_];
+            force_ = bodies.forces[body_index_];
+        }
         physics_engine_->unregisterComponent(this);
         spdlog::trace("物理组件清理完成。");
     }
 
+    void PhysicsComponent::refreshCachedComponents()
+    {
+        if (isRegistered())
+        {
+            physics_engine_->refreshComponentCache(this);
+        }
+    }
+
+    void PhysicsComponent::addForce(const glm::vec2 &force)
+    {
+        if (!isRegistered())
+        {
+            if (enabled_)
+                force_ += force;
+            return;
+        }
+        auto &bodies = physics_engine_->getBodyStorage();
+        if (bodies.enabled[body_index_])
+        {
+            bodies.forces[body_index_] += force;
+            if (force.x != 0.0f || force.y != 0.0f)
+            {
+                bodies.wake(body_index_); // 受到外力时唤醒
+            }
+        }
+    }
+
+    void PhysicsComponent::clearForce()
+    {
+        force_ = {0.0f, 0.0f};
+        if (isRegistered())
+            physics_engine_->getBodyStorage().forces[body_index_] = {0.0f, 0.0f};
+    }
+
+    glm::vec2 PhysicsComponent::getForce() const
+    {
+        return isRegistered() ? physics_engine_->getBodyStorage().forces[body_index_] : force_;
+    }
+
+    float PhysicsComponent::getMass() const
+    {
+        return isRegistered() ? physics_engine_->getBodyStorage().masses[body_index_] : mass_;
+    }
+
+    bool PhysicsComponent::isEnabled() const
+    {
+        return isRegistered() ? physics_engine_->getBodyStorage().enabled[body_index_] != 0 : enabled_;
+    }
+
+    bool PhysicsComponent::isUseGravity() const
+    {
+        return isRegistered() ? physics_engine_->getBodyStorage().use_gravity[body_index_] != 0 : use_gravity_;
+    }
+
+    void PhysicsComponent::setEnabled(bool enabled)
+    {
+        enabled_ = enabled;
+        if (!isRegistered())
+            return;
+        auto &bodies = physics_engine_->getBodyStorage();
+        bodies.enabled[body_index_] = enabled ? 1 : 0;
+        if (enabled)
+            bodies.wake(body_index_);
+    }
+
+    void PhysicsComponent::setMass(float mass)
+    {
+        mass_ = (mass >= 0.0f) ? mass : 1.0f;
+        if (isRegistered())
+            physics_engine_->getBodyStorage().masses[body_index_] = mass_;
+    }
+
+    void PhysicsComponent::setUseGravity(bool use_gravity)
+    {
+        use_gravity_ = use_gravity;
+        if (!isRegistered())
+            return;
+        auto &bodies = physics_engine_->getBodyStorage();
+        if (bodies.use_gravity[body_index_] != (use_gravity ? 1 : 0))
+        {
+            bodies.use_gravity[body_index_] = use_gravity ? 1 : 0;
+            bodies.wake(body_index_);
+        }
+    }
+
+    // 速度只有真正改变时才唤醒物体，避免每帧写入相同速度（如摩擦衰减到0后）导致物体无法休眠
+    void PhysicsComponent::setVelocity(glm::vec2 velocity)
+    {
+        if (!isRegistered())
+        {
+            velocity_ = velocity;
+            return;
+        }
+        auto &bodies = physics_engine_->getBodyStorage();
+        if (bodies.velocities[body_index_] != velocity)
+        {
+            bodies.velocities[body_index_] = std::move(velocity);
+            bodies.wake(body_index_);
+        }
+    }
+
+    void PhysicsComponent::setVelocityX(float velocity_x)
+    {
+        if (!isRegistered())
+        {
+            velocity_.x = velocity_x;
+            return;
+        }
+        auto &bodies = physics_engine_->getBodyStorage();
+        if (bodies.velocities[body_index_].x != velocity_x)
+        {
+            bodies.velocities[body_index_].x = velocity_x;
+            bodies.wake(body_index_);
+        }
+    }
+
+    void PhysicsComponent::setVelocityY(float velocity_y)
+    {
+        if (!isRegistered())
+        {
+            velocity_.y = velocity_y;
+            return;
+        }
+        auto &bodies = physics_engine_->getBodyStorage();
+        if (bodies.velocities[body_index_].y != velocity_y)
+        {
+            bodies.velocities[body_index_].y = velocity_y;
+            bodies.wake(body_index_);
+        }
+    }
+
+    void PhysicsComponent::setBodyType(engine::physics::BodyType type)
+    {
+        body_type_ = type;
+        if (!isRegistered())
+            return;
+        auto &bodies = physics_engine_->getBodyStorage();
+        bodies.types[body_index_] = type;
+        bodies.wake(body_index_);
+    }
+
+    engine::physics::BodyType PhysicsComponent::getBodyType() const
+    {
+        return isRegistered() ? physics_engine_->getBodyStorage().types[body_index_] : body_type_;
+    }
+
+    bool PhysicsComponent::isSleeping() const
+    {
+        return isRegistered() && physics_engine_->getBodyStorage().sleeping[body_index_] != 0;
+    }
+
+    void PhysicsComponent::wakeUp()
+    {
+        if (isRegistered())
+            physics_engine_->getBodyStorage().wake(body_index_);
+    }
+
+    glm::vec2 PhysicsComponent::getVelocity() const
+    {
+        return isRegistered() ? physics_engine_->getBodyStorage().velocities[body_index_] : velocity_;
+    }
+
+    bool PhysicsComponent::hasFlag(std::uint8_t flag) const
+    {
+        return isRegistered() && (physics_engine_->getBodyStorage().flags[body_index_] & flag) != 0;
+    }
+
+    bool PhysicsComponent::hasCollidedBelow() const { return hasFlag(engine::physics::body_flag::COLLIDED_BELOW); }
+    bool PhysicsComponent::hasCollidedAbove() const { return hasFlag(engine::physics::body_flag::COLLIDED_ABOVE); }
+    bool PhysicsComponent::hasCollidedLeft() const { return hasFlag(engine::physics::body_flag::COLLIDED_LEFT); }
+    bool PhysicsComponent::hasCollidedRight() const { return hasFlag(engine::physics::body_flag::COLLIDED_RIGHT); }
+    bool PhysicsComponent::hasCollidedLadder() const { return hasFlag(engine::physics::body_flag::COLLIDED_LADDER); }
+    bool PhysicsComponent::isOnTopLadder() const { return hasFlag(engine::physics::body_flag::ON_TOP_LADDER); }
+
 } // namespace engine::component
\ No newline at end of file
@@ -2,10 +2,13 @@
 #include "component.h"
 #include "glm/vec2.hpp"
 #include <utility>
+#include <cstdint>
+#include <cstddef>
 
 namespace engine::physics
 {
     class PhysicsEngine;
+    enum class BodyType : std::uint8_t;
 }
 
 namespace engine::component
@@ -15,31 +18,29 @@ namespace engine::component
     /**
      * @brief 管理GameObject的物理属性
      *
-     * 存储速度、质量、力和重力设置。与PhysicsEngine交互。
+     * 速度、质量、力、重力设置和碰撞标志等模拟数据由PhysicsEngine以结构数组形式统一存储，
+     * 组件只保存自己在其中的下标，并通过访问器读写对应数据。
      */
     class PhysicsComponent final : public Component
     {
         friend class engine::object::GameObject;
+        friend class engine::physics::PhysicsEngine; ///< @brief 物理引擎负责维护 body_index_
 
     public:
-        glm::vec2 velocity_ = {0.0f, 0.0f}; ///< @brief 物体的速度，设为公共成员变量，方便PhysicsEngine访问更新
+        static constexpr size_t INVALID_INDEX = static_cast<size_t>(-1);
 
     private:
         engine::physics::PhysicsEngine *physics_engine_ = nullptr; ///< @brief 指向PhysicsEngine的指针
         TransformComponent *transform_ = nullptr;                  ///< @brief TransformComponent的缓存指针
+        size_t body_index_ = INVALID_INDEX;                        ///< @brief 在PhysicsEngine物体数组中的下标（由引擎维护）
 
-        glm::vec2 force_ = {0.0f, 0.0f}; ///< @brief 当前帧受到的力
-        float mass_ = 1.0f;              ///< @brief 物体质量（默认1.0）
-        bool use_gravity_ = true;        ///< @brief 物体是否受重力影响
-        bool enabled_ = true;            ///< @brief 组件是否激活
-
-        // --- 碰撞状态标志 ---
-        bool collided_below_ = false;
-        bool collided_above_ = false;
-        bool collided_left_ = false;
-        bool collided_right_ = false;
-        bool collided_ladder_ = false;  ///< @brief 是否与梯子发生碰撞
-        bool is_on_top_ladder_ = false; ///< @brief 是否在梯子顶层（梯子上方没有瓦片）
+        // --- 未注册到PhysicsEngine时（init() 之前或 clean() 之后）使用的本地值，注册时复制到引擎的物体数组中 ---
+        float mass_ = 1.0f;                     ///< @brief 物体质量（默认1.0）
+        bool use_gravity_ = true;               ///< @brief 物体是否受重力影响
+        engine::physics::BodyType body_type_{}; ///< @brief 物体类型（默认动态）
+        bool enabled_ = true;                   ///< @brief 组件是否启用
+        glm::vec2 velocity_ = {0.0f, 0.0f};     ///< @brief 速度
+        glm::vec2 force_ = {0.0f, 0.0f};        ///< @brief 累积的力
 
     public:
         /**
@@ -58,57 +59,52 @@ namespace engine::component
         PhysicsComponent(PhysicsComponent &&) = delete;
         PhysicsComponent &operator=(PhysicsComponent &&) = delete;
 
-        // PhysicsEngine使用的物理方法
-        void addForce(const glm::vec2 &force)
-        {
-            if (enabled_)
-                force_ += force;
-        } ///< @brief 添加力
-        void clearForce() { force_ = {0.0f, 0.0f}; }         ///< @brief 清除力
-        const glm::vec2 &getForce() const { return force_; } ///< @brief 获取当前力
-        float getMass() const { return mass_; }              ///< @brief 获取质量
-        bool isEnabled() const { return enabled_; }          ///< @brief 获取组件是否启用
-        bool isUseGravity() const { return use_gravity_; }   ///< @brief 获取组件是否受重力影响
+        // 物理方法
+        void addForce(const glm::vec2 &force); ///< @brief 添加力
+        void clearForce();                     ///< @brief 清除力
+        glm::vec2 getForce() const;            ///< @brief 获取当前力
+        float getMass() const;                 ///< @brief 获取质量
+        bool isEnabled() const;                ///< @brief 获取组件是否启用
+        bool isUseGravity() const;             ///< @brief 获取组件是否受重力影响
 
         // 设置器/获取器
-        void setEnabled(bool enabled) { enabled_ = enabled; }                     ///< @brief 设置组件是否启用
-        void setMass(float mass) { mass_ = (mass >= 0.0f) ? mass : 1.0f; }        ///< @brief 设置质量，质量不能为负
-        void setUseGravity(bool use_gravity) { use_gravity_ = use_gravity; }      ///< @brief 设置组件是否受重力影响
-        void setVelocity(glm::vec2 velocity) { velocity_ = std::move(velocity); } ///< @brief 设置速度
-        const glm::vec2 &getVelocity() const { return velocity_; }                ///< @brief 获取当前速度
-        TransformComponent *getTransform() const { return transform_; }           ///< @brief 获取TransformComponent指针
-
-        // --- 碰撞状态访问与修改 (供 PhysicsEngine 使用) ---
-        /** @brief 重置所有碰撞标志 (在物理更新开始时调用) */
-        void resetCollisionFlags()
-        {
-            collided_below_ = false;
-            collided_above_ = false;
-            collided_left_ = false;
-            collided_right_ = false;
-            collided_ladder_ = false;
-            is_on_top_ladder_ = false;
-        }
-
-        void setCollidedBelow(bool collided) { collided_below_ = collided; }   ///< @brief 设置下方碰撞标志
-        void setCollidedAbove(bool collided) { collided_above_ = collided; }   ///< @brief 设置上方碰撞标志
-        void setCollidedLeft(bool collided) { collided_left_ = collided; }     ///< @brief 设置左方碰撞标志
-        void setCollidedRight(bool collided) { collided_right_ = collided; }   ///< @brief 设置右方碰撞标志
-        void setCollidedLadder(bool collided) { collided_ladder_ = collided; } ///< @brief 设置梯子碰撞标志
-        void setOnTopLadder(bool on_top) { is_on_top_ladder_ = on_top; }       ///< @brief 设置是否在梯子顶层
-
-        bool hasCollidedBelow() const { return collided_below_; }   ///< @brief 检查是否与下方发生碰撞
-        bool hasCollidedAbove() const { return collided_above_; }   ///< @brief 检查是否与上方发生碰撞
-        bool hasCollidedLeft() const { return collided_left_; }     ///< @brief 检查是否与左方发生碰撞
-        bool hasCollidedRight() const { return collided_right_; }   ///< @brief 检查是否与右方发生碰撞
-        bool hasCollidedLadder() const { return collided_ladder_; } ///< @brief 检查是否与梯子发生碰撞
-        bool isOnTopLadder() const { return is_on_top_ladder_; }    ///< @brief 检查是否在梯子顶层
+        void setEnabled(bool enabled);                                  ///< @brief 设置组件是否启用
+        void setMass(float mass);                                       ///< @brief 设置质量，质量不能为负
+        void setUseGravity(bool use_gravity);                           ///< @brief 设置组件是否受重力影响
+        void setVelocity(glm::vec2 velocity);                           ///< @brief 设置速度
+        void setVelocityX(float velocity_x);                            ///< @brief 设置水平速度
+        void setVelocityY(float velocity_y);                            ///< @brief 设置垂直速度
+        glm::vec2 getVelocity() const;                                  ///< @brief 获取当前速度
+        TransformComponent *getTransform() const { return transform_; } ///< @brief 获取TransformComponent指针
+        size_t getBodyIndex() const { return body_index_; }             ///< @brief 获取在PhysicsEngine物体数组中的下标
+        /// @brief 获取物理引擎指针（用于射线检测等空间查询）
+        engine::physics::PhysicsEngine *getPhysicsEngine() const { return physics_engine_; }
+
+        // --- 物体类型与休眠 ---
+        void setBodyType(engine::physics::BodyType type); ///< @brief 设置物体类型（动态/运动学/静态）
+        engine::physics::BodyType getBodyType() const;    ///< @brief 获取物体类型
+        bool isSleeping() const;                          ///< @brief 检查物体是否处于休眠状态
+        void wakeUp();                                    ///< @brief 唤醒物体（设置速度、施加力等操作会自动唤醒）
+
+        /// @brief 重新缓存同一GameObject上的Transform/Collider组件 (在本组件之后添加碰撞组件时调用)
+        void refreshCachedComponents();
+
+        // --- 碰撞状态访问 (由 PhysicsEngine 在每次更新时写入) ---
+        bool hasCollidedBelow() const;  ///< @brief 检查是否与下方发生碰撞
+        bool hasCollidedAbove() const;  ///< @brief 检查是否与上方发生碰撞
+        bool hasCollidedLeft() const;   ///< @brief 检查是否与左方发生碰撞
+        bool hasCollidedRight() const;  ///< @brief 检查是否与右方发生碰撞
+        bool hasCollidedLadder() const; ///< @brief 检查是否与梯子发生碰撞
+        bool isOnTopLadder() const;     ///< @brief 检查是否在梯子顶层
 
     private:
+        bool isRegistered() const { return physics_engine_ && body_index_ != INVALID_INDEX; } ///< @brief 是否已注册到PhysicsEngine
+        bool hasFlag(std::uint8_t flag) const;                                                 ///< @brief 检查碰撞状态位
+
         // 核心循环方法
         void init() override;
         void update(float, engine::core::Context &) override {}
         void clean() override;
     };
 
-} // namespace engine::component
\ No newline at end of file
+} // namespace engine::component
@@ -56,6 +56,12 @@ namespace engine::component
             return;
         }
 
+        // 解析纹理句柄，之后绘制时不再按纹理ID查找
+        if (resource_manager_)
+        {
+            sprite_.setTextureHandle(resource_manager_->getTextureHandle(sprite_.getTextureId()));
+        }
+
         // 获取大小及偏移
         updateSpriteSize();
         updateOffset();
@@ -119,8 +125,8 @@ namespace engine::component
             return;
         }
 
-        // 获取变换信息（考虑偏移量）
-        const glm::vec2 &pos = transform_->getPosition() + offset_;
+        // 获取变换信息（考虑偏移量，固定步长模式下在前后两个状态之间插值）
+        const glm::vec2 &pos = transform_->getInterpolatedPosition(context.getCamera().getInterpolationAlpha()) + offset_;
         const glm::vec2 &scale = transform_->getScale();
         float rotation_degrees = transform_->getRotation();
 
@@ -132,6 +138,10 @@ namespace engine::component
     {
         sprite_.setTextureId(texture_id);
         sprite_.setSourceRect(std::move(source_rect_opt));
+        if (resource_manager_)
+        {
+            sprite_.setTextureHandle(resource_manager_->getTextureHandle(sprite_.getTextureId()));
+        }
 
         updateSpriteSize();
         updateOffset();
@@ -159,7 +169,8 @@ namespace engine::component
         else
         {
             // 整个纹理就是精灵图大小
-            sprite_size_ = resource_manager_->getTextureSize(sprite_.getTextureId());
+            sprite_size_ = sprite_.getTextureHandle().isValid() ? resource_manager_->getTextureSize(sprite_.getTextureHandle())
+                                                                : resource_manager_->getTextureSize(sprite_.getTextureId());
         }
     }
 
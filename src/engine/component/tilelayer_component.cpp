@@ -4,7 +4,11 @@
 #include "../render/renderer.h"
 #include "../render/camera.h"
 #include "../physics/physics_engine.h"
+#include <SDL3/SDL_render.h>
 #include <spdlog/spdlog.h>
+#include <glm/common.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace engine::component
 {
@@ -20,6 +24,7 @@ namespace engine::component
             tiles_.clear();
             map_size_ = {0, 0};
         }
+        initChunks();
         spdlog::trace("TileLayerComponent 构造完成");
     }
 
@@ -34,31 +39,41 @@ namespace engine::component
 
     void TileLayerComponent::render(engine::core::Context &context)
     {
-        if (tile_size_.x <= 0 || tile_size_.y <= 0)
+        if (tile_size_.x <= 0 || tile_size_.y <= 0 || chunks_.empty())
         {
             return; // 防止除以零或无效尺寸
         }
-        // 遍历所有瓦片
-        for (int y = 0; y < map_size_.y; ++y)
+        const auto &camera = context.getCamera();
+        glm::ivec2 first_tile, last_tile;
+        if (!getVisibleTileRange(camera, first_tile, last_tile))
         {
-            for (int x = 0; x < map_size_.x; ++x)
+            return;
+        }
+        if (!chunks_enabled_)
+        {
+            renderTiles(first_tile, last_tile, context);
+            return;
+        }
+
+        // 只处理与可见瓦片范围重叠的区块
+        auto first = first_tile / CHUNK_TILES;
+        auto last = last_tile / CHUNK_TILES;
+        auto &renderer = context.getRenderer();
+        for (int cy = first.y; cy <= last.y; ++cy)
+        {
+            for (int cx = first.x; cx <= last.x; ++cx)
             {
-                size_t index = static_cast<size_t>(y) * map_size_.x + x;
-                // 检查索引有效性以及瓦片是否需要渲染
-                if (index < tiles_.size() && tiles_[index].type != TileType::EMPTY)
+                auto &chunk = chunks_[static_cast<size_t>(cy) * chunk_count_.x + cx];
+                if (chunk.dirty && !bakeChunk({cx, cy}, renderer))
                 {
-                    const auto &tile_info = tiles_[index];
-                    // 计算该瓦片在世界中的左上角位置 (drawSprite 预期接收左上角坐标)
-                    glm::vec2 tile_left_top_pos = {
-                        offset_.x + static_cast<float>(x) * tile_size_.x,
-                        offset_.y + static_cast<float>(y) * tile_size_.y};
-                    // 但如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
-                    if (static_cast<int>(tile_info.sprite.getSourceRect()->h) != tile_size_.y)
-                    {
-                        tile_left_top_pos.y -= (tile_info.sprite.getSourceRect()->h - static_cast<float>(tile_size_.y));
-                    }
-                    // 执行绘制
-                    context.getRenderer().drawSprite(context.getCamera(), tile_info.sprite, tile_left_top_pos);
+                    spdlog::warn("TileLayerComponent: 无法烘焙瓦片区块，退回逐瓦片绘制。");
+                    chunks_enabled_ = false;
+                    renderTiles(first_tile, last_tile, context);
+                    return;
+                }
+                if (chunk.texture)
+                {
+                    renderer.drawTexture(camera, chunk.texture.get(), offset_ + getChunkOrigin({cx, cy}), glm::vec2(chunk.texture_size));
                 }
             }
         }
@@ -66,12 +81,176 @@ namespace engine::component
 
     void TileLayerComponent::clean()
     {
+        chunks_.clear(); // 区块纹理需要在渲染器销毁之前释放
         if (physics_engine_)
         {
             physics_engine_->unregisterCollisionLayer(this);
         }
     }
 
+    bool TileLayerComponent::setTileAt(glm::ivec2 pos, TileInfo tile)
+    {
+        if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y)
+        {
+            spdlog::warn("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);
+            return false;
+        }
+        auto &target = tiles_[static_cast<size_t>(pos.y) * map_size_.x + pos.x];
+        auto type_changed = target.type != tile.type;
+        target = std::move(tile);
+
+        auto previous_overhang = overhang_;
+        updateOverhang(target);
+        if (overhang_ != previous_overhang)
+        { // 区块纹理尺寸变了，全部重新烘焙
+            for (auto &chunk : chunks_)
+                chunk.dirty = true;
+        }
+        else
+        {
+            auto chunk = pos / CHUNK_TILES;
+            chunks_[static_cast<size_t>(chunk.y) * chunk_count_.x + chunk.x].dirty = true;
+        }
+
+        if (type_changed && physics_engine_)
+        {
+            physics_engine_->refreshCollisionLayers();
+        }
+        return true;
+    }
+
+    void TileLayerComponent::ChunkTextureDeleter::operator()(SDL_Texture *texture) const
+    {
+        if (texture)
+        {
+            SDL_DestroyTexture(texture);
+        }
+    }
+
+    void TileLayerComponent::initChunks()
+    {
+        chunks_.clear();
+        overhang_ = {0, 0};
+        chunk_count_ = (map_size_ + CHUNK_TILES - 1) / CHUNK_TILES;
+        if (map_size_.x <= 0 || map_size_.y <= 0)
+        {
+            chunk_count_ = {0, 0};
+            return;
+        }
+        chunks_.resize(static_cast<size_t>(chunk_count_.x) * chunk_count_.y);
+        for (const auto &tile : tiles_)
+        {
+            updateOverhang(tile);
+        }
+    }
+
+    void TileLayerComponent::updateOverhang(const TileInfo &tile)
+    {
+        const auto &src_rect = tile.sprite.getSourceRect();
+        if (tile.type == TileType::EMPTY || !src_rect.has_value())
+        {
+            return;
+        }
+        overhang_.x = std::max(overhang_.x, static_cast<int>(std::ceil(src_rect->w)) - tile_size_.x);
+        overhang_.y = std::max(overhang_.y, static_cast<int>(std::ceil(src_rect->h)) - tile_size_.y);
+    }
+
+    glm::vec2 TileLayerComponent::getTileDrawOffset(glm::ivec2 pos) const
+    {
+        const auto &tile_info = tiles_[static_cast<size_t>(pos.y) * map_size_.x + pos.x];
+        glm::vec2 tile_left_top_pos = glm::vec2(pos * tile_size_);
+        // 如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
+        const auto &src_rect = tile_info.sprite.getSourceRect();
+        if (src_rect.has_value() && static_cast<int>(src_rect->h) != tile_size_.y)
+        {
+            tile_left_top_pos.y -= (src_rect->h - static_cast<float>(tile_size_.y));
+        }
+        return tile_left_top_pos;
+    }
+
+    glm::vec2 TileLayerComponent::getChunkOrigin(glm::ivec2 chunk) const
+    {
+        return glm::vec2(chunk * CHUNK_TILES * tile_size_) - glm::vec2(0.0f, static_cast<float>(overhang_.y));
+    }
+
+    bool TileLayerComponent::bakeChunk(glm::ivec2 chunk_pos, engine::render::Renderer &renderer)
+    {
+        auto &chunk = chunks_[static_cast<size_t>(chunk_pos.y) * chunk_count_.x + chunk_pos.x];
+        auto tile_begin = chunk_pos * CHUNK_TILES;
+        auto tile_end = glm::min(tile_begin + CHUNK_TILES, map_size_);
+
+        auto has_tiles = false;
+        for (int y = tile_begin.y; y < tile_end.y && !has_tiles; ++y)
+        {
+            for (int x = tile_begin.x; x < tile_end.x && !has_tiles; ++x)
+            {
+                has_tiles = tiles_[static_cast<size_t>(y) * map_size_.x + x].type != TileType::EMPTY;
+            }
+        }
+        if (!has_tiles)
+        { // 空区块不需要纹理
+            chunk.texture.reset();
+            chunk.texture_size = {0, 0};
+            chunk.dirty = false;
+            return true;
+        }
+
+        auto size = (tile_end - tile_begin) * tile_size_ + overhang_;
+        if (!chunk.texture || chunk.texture_size != size)
+        {
+            chunk.texture.reset(renderer.createTargetTexture(size));
+            chunk.texture_size = chunk.texture ? size : glm::ivec2(0, 0);
+        }
+        if (!chunk.texture || !renderer.beginRenderToTexture(chunk.texture.get()))
+        {
+            return false;
+        }
+        auto origin = getChunkOrigin(chunk_pos);
+        for (int y = tile_begin.y; y < tile_end.y; ++y)
+        {
+            for (int x = tile_begin.x; x < tile_end.x; ++x)
+            {
+                const auto &tile_info = tiles_[static_cast<size_t>(y) * map_size_.x + x];
+                if (tile_info.type != TileType::EMPTY)
+                {
+                    renderer.drawUISprite(tile_info.sprite, getTileDrawOffset({x, y}) - origin);
+                }
+            }
+        }
+        renderer.endRenderToTexture();
+        chunk.dirty = false;
+        return true;
+    }
+
+    bool TileLayerComponent::getVisibleTileRange(const engine::render::Camera &camera, glm::ivec2 &first, glm::ivec2 &last) const
+    {
+        // 相机视野（相对于瓦片层，使用与绘制相同的插值位置）
+        auto view_min = camera.getRenderPosition() - offset_;
+        auto view_max = view_min + camera.getViewportSize();
+        // 图片比瓦片大时按左下角对齐，会向上、向右超出瓦片，因此视野下侧和左侧需要多取 overhang_
+        auto tile_size = glm::vec2(tile_size_);
+        first = glm::ivec2(glm::floor((view_min - glm::vec2(overhang_.x, 0.0f)) / tile_size));
+        last = glm::ivec2(glm::floor((view_max + glm::vec2(0.0f, overhang_.y)) / tile_size));
+        first = glm::max(first, glm::ivec2(0));
+        last = glm::min(last, map_size_ - 1);
+        return first.x <= last.x && first.y <= last.y;
+    }
+
+    void TileLayerComponent::renderTiles(glm::ivec2 first, glm::ivec2 last, engine::core::Context &context)
+    {
+        for (int y = first.y; y <= last.y; ++y)
+        {
+            for (int x = first.x; x <= last.x; ++x)
+            {
+                const auto &tile_info = tiles_[static_cast<size_t>(y) * map_size_.x + x];
+                if (tile_info.type != TileType::EMPTY)
+                {
+                    context.getRenderer().drawSprite(context.getCamera(), tile_info.sprite, offset_ + getTileDrawOffset({x, y}));
+                }
+            }
+        }
+    }
+
     const TileInfo *TileLayerComponent::getTileInfoAt(glm::ivec2 pos) const
     {
         if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y)
@@ -4,12 +4,18 @@
 #include "component.h"
 
 #include <vector>
+#include <memory>
+#include <cstdint>
 
 #include <glm/vec2.hpp>
 
+struct SDL_Texture;
+
 namespace engine::render
 {
     class Sprite;
+    class Renderer;
+    class Camera;
 }
 
 namespace engine::core
@@ -29,18 +35,19 @@ namespace engine::component
      */
     enum class TileType
     {
-        EMPTY,     ///< @brief 空白瓦片
-        NORMAL,    ///< @brief 普通瓦片
-        SOLID,     ///< @brief 静止可碰撞瓦片
-        UNISOLID,  ///< @brief 单向静止可碰撞瓦片
-        SLOPE_0_1, ///< @brief 斜坡瓦片，高度:左0  右1
-        SLOPE_1_0, ///< @brief 斜坡瓦片，高度:左1  右0
-        SLOPE_0_2, ///< @brief 斜坡瓦片，高度:左0  右1/2
-        SLOPE_2_1, ///< @brief 斜坡瓦片，高度:左1/2右1
-        SLOPE_1_2, ///< @brief 斜坡瓦片，高度:左1  右1/2
-        SLOPE_2_0, ///< @brief 斜坡瓦片，高度:左1/2右0
-        HAZARD,    ///< @brief 危险瓦片（例如火焰、尖刺等）
-        LADDER,    ///< @brief 梯子瓦片
+        EMPTY,        ///< @brief 空白瓦片
+        NORMAL,       ///< @brief 普通瓦片
+        SOLID,        ///< @brief 静止可碰撞瓦片
+        UNISOLID,     ///< @brief 单向静止可碰撞瓦片
+        SLOPE_0_1,    ///< @brief 斜坡瓦片，高度:左0  右1
+        SLOPE_1_0,    ///< @brief 斜坡瓦片，高度:左1  右0
+        SLOPE_0_2,    ///< @brief 斜坡瓦片，高度:左0  右1/2
+        SLOPE_2_1,    ///< @brief 斜坡瓦片，高度:左1/2右1
+        SLOPE_1_2,    ///< @brief 斜坡瓦片，高度:左1  右1/2
+        SLOPE_2_0,    ///< @brief 斜坡瓦片，高度:左1/2右0
+        SLOPE_CUSTOM, ///< @brief 斜坡瓦片，高度由瓦片集指定的高度轮廓决定
+        HAZARD,       ///< @brief 危险瓦片（例如火焰、尖刺等）
+        LADDER,       ///< @brief 梯子瓦片
         // 未来补充其它类型
     };
 
@@ -49,22 +56,46 @@ namespace engine::component
      */
     struct TileInfo
     {
-        render::Sprite sprite; ///< @brief 瓦片的视觉表示
-        TileType type;         ///< @brief 瓦片的逻辑类型
-        TileInfo(render::Sprite s = render::Sprite(), TileType t = TileType::EMPTY) : sprite(std::move(s)), type(t) {}
+        render::Sprite sprite;           ///< @brief 瓦片的视觉表示
+        TileType type;                   ///< @brief 瓦片的逻辑类型
+        std::uint8_t height_profile = 0; ///< @brief 斜坡高度轮廓编号（0 表示使用瓦片类型的默认轮廓）
+        TileInfo(render::Sprite s = render::Sprite(), TileType t = TileType::EMPTY, std::uint8_t profile = 0)
+            : sprite(std::move(s)), type(t), height_profile(profile) {}
     };
 
     /**
      * @brief 管理和渲染瓦片地图层。
      *
      * 存储瓦片地图的布局、每个瓦片的精灵信息和类型。
-     * 负责在渲染阶段绘制可见的瓦片。
+     * 瓦片层是静态的，因此按 CHUNK_TILES x CHUNK_TILES 划分区块，每个区块预先烘焙到一张渲染目标纹理上，
+     * 渲染时只绘制与相机视野重叠的区块；区块只在其中的瓦片被修改后才重新烘焙。
+     * 渲染器不支持渲染目标纹理时退回逐瓦片绘制。
      */
     class TileLayerComponent final : public Component
     {
         friend class engine::object::GameObject;
 
+    public:
+        static constexpr int CHUNK_TILES = 32; ///< @brief 每个区块包含的瓦片数（每个方向）
+
     private:
+        /// @brief 释放区块纹理的删除器
+        struct ChunkTextureDeleter
+        {
+            void operator()(SDL_Texture *texture) const;
+        };
+
+        /**
+         * @brief 预烘焙区块。
+         * 纹理左上角位于区块左上角再向上 overhang_.y 处，并向右多出 overhang_.x，用于容纳比瓦片更大的图片。
+         */
+        struct Chunk
+        {
+            std::unique_ptr<SDL_Texture, ChunkTextureDeleter> texture; ///< @brief 烘焙结果（区块内没有瓦片时为空）
+            glm::ivec2 texture_size = {0, 0};                          ///< @brief 纹理尺寸（像素）
+            bool dirty = true;                                         ///< @brief 是否需要重新烘焙
+        };
+
         glm::ivec2 tile_size_;                                     ///< @brief 单个瓦片尺寸（像素）
         glm::ivec2 map_size_;                                      ///< @brief 地图尺寸（瓦片数）
         std::vector<TileInfo> tiles_;                              ///< @brief 存储所有瓦片信息 (按"行主序"存储, index = y * map_width_ + x)
@@ -73,6 +104,11 @@ namespace engine::component
         bool is_hidden_ = false;                                   ///< @brief 是否隐藏（不渲染）
         engine::physics::PhysicsEngine *physics_engine_ = nullptr; ///< @brief 物理引擎的指针， clean()函数中可能需要反注册
 
+        std::vector<Chunk> chunks_;                                ///< @brief 按行主序存储的预烘焙区块
+        glm::ivec2 chunk_count_ = {0, 0};                          ///< @brief 区块网格尺寸
+        glm::ivec2 overhang_ = {0, 0};                             ///< @brief 图片超出瓦片的最大尺寸（向右、向上，像素）
+        bool chunks_enabled_ = true;                               ///< @brief 是否使用预烘焙区块（创建渲染目标失败后关闭）
+
     public:
         TileLayerComponent() = default;
 
@@ -105,6 +141,15 @@ namespace engine::component
          */
         TileType getTileTypeAtWorldPos(const glm::vec2 &world_pos) const;
 
+        /**
+         * @brief 修改指定位置的瓦片，并标记所在区块需要重新烘焙。
+         * 瓦片类型变化时会通知物理引擎重建碰撞网格（代价与地图大小成正比，不宜每帧大量调用）。
+         * @param pos 瓦片坐标 (0 <= x < map_size_.x, 0 <= y < map_size_.y)
+         * @param tile 新的瓦片信息
+         * @return 坐标有效并已修改时返回 true
+         */
+        bool setTileAt(glm::ivec2 pos, TileInfo tile);
+
         // getters and setters
         glm::ivec2 getTileSize() const { return tile_size_; } ///< @brief 获取单个瓦片尺寸
         glm::ivec2 getMapSize() const { return map_size_; }   ///< @brief 获取地图尺寸
@@ -126,6 +171,22 @@ namespace engine::component
         void update(float, engine::core::Context &) override {}
         void render(engine::core::Context &context) override;
         void clean() override;
+
+    private:
+        void initChunks();                                                                   ///< @brief 根据地图尺寸划分区块，并计算图片超出瓦片的尺寸
+        void updateOverhang(const TileInfo &tile);                                           ///< @brief 用单个瓦片的图片尺寸扩展 overhang_
+        glm::vec2 getTileDrawOffset(glm::ivec2 pos) const;                                   ///< @brief 瓦片图片左上角相对于瓦片层的位置（图片按左下角对齐）
+        glm::vec2 getChunkOrigin(glm::ivec2 chunk) const;                                    ///< @brief 区块纹理左上角相对于瓦片层的位置
+        bool bakeChunk(glm::ivec2 chunk, engine::render::Renderer &renderer);                ///< @brief 把区块内的瓦片绘制到区块纹理上，失败返回 false
+        void renderTiles(glm::ivec2 first, glm::ivec2 last, engine::core::Context &context); ///< @brief 逐瓦片绘制 [first, last] 范围（不支持渲染目标时使用）
+
+        /**
+         * @brief 计算相机视野内可能可见的瓦片范围（考虑比瓦片大、向上和向右超出的图片）。
+         * @param first 输出：起始瓦片坐标（包含）
+         * @param last 输出：终止瓦片坐标（包含）
+         * @return 范围为空时返回 false
+         */
+        bool getVisibleTileRange(const engine::render::Camera &camera, glm::ivec2 &first, glm::ivec2 &last) const;
     };
 
 } // namespace engine::component
\ No newline at end of file
@@ -18,6 +18,11 @@ namespace engine::component
         glm::vec2 scale_ = {1.0f, 1.0f};    // 缩放
         float rotation_ = 0.0f;             // 角度制，单位：度
 
+    private:
+        glm::vec2 previous_position_ = {0.0f, 0.0f}; // 上一个固定步开始时的位置（用于渲染插值）
+
+    public:
+
         /**
          * @brief 构造函数
          * @param position 位置
@@ -25,7 +30,7 @@ namespace engine::component
          * @param rotation 旋转
          */
         TransformComponent(glm::vec2 position = {0.0f, 0.0f}, glm::vec2 scale = {1.0f, 1.0f}, float rotation = 0.0f)
-            : position_(std::move(position)), scale_(std::move(scale)), rotation_(rotation) {}
+            : position_(std::move(position)), scale_(std::move(scale)), rotation_(rotation), previous_position_(position_) {}
 
         // 禁止拷贝和移动
         TransformComponent(const TransformComponent &) = delete;
@@ -38,10 +43,26 @@ namespace engine::component
         float getRotation() const { return rotation_; }                           // 获取旋转
         const glm::vec2 &getScale() const { return scale_; }                      // 获取缩放
         void setPosition(glm::vec2 position) { position_ = std::move(position); } // 设置位置
+        void teleport(glm::vec2 position) { position_ = previous_position_ = position; } // 瞬移到指定位置（同时重置插值状态，不会从旧位置拖影）
         void setRotation(float rotation) { rotation_ = rotation; }                // 设置旋转角度
         void setScale(glm::vec2 scale);                                           // 设置缩放，应用缩放时应同步更新Sprite偏移量
         void translate(const glm::vec2 &offset) { position_ += offset; }          // 平移
 
+        // 渲染插值
+        void storePreviousPosition() { previous_position_ = position_; } // 记录当前位置作为插值的上一状态（每个固定步开始时调用）
+        /**
+         * @brief 获取在上一状态与当前状态之间插值后的位置
+         * @param alpha 插值因子，0 为上一状态，1 为当前状态
+         */
+        glm::vec2 getInterpolatedPosition(float alpha) const
+        {
+            if (alpha >= 1.0f)
+            {
+                return position_;
+            }
+            return previous_position_ + (position_ - previous_position_) * alpha;
+        }
+
     private:
         void update(float, engine::core::Context &) override {} // 覆盖纯虚函数，这里不需要实现
     };
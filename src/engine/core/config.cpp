@@ -2,6 +2,7 @@
 #include <fstream>
 #include <filesystem>
 #include <nlohmann/json.hpp>
+#include <charconv>
 #include "spdlog/spdlog.h"
 
 namespace engine::core
@@ -76,6 +77,14 @@ namespace engine::core
         {
             const auto &graphics_config = j["graphics"];
             vsync_enabled_ = graphics_config.value("vsync", vsync_enabled_);
+            render_backend_ = graphics_config.value("backend", render_backend_);
+            validateRenderBackend();
+            render_stats_interval_ = graphics_config.value("stats_interval", render_stats_interval_);
+            if (render_stats_interval_ < 0)
+            {
+                spdlog::warn("渲染统计输出间隔不能为负数。设置为 0（不输出）。");
+                render_stats_interval_ = 0;
+            }
         }
         if (j.contains("performance"))
         {
@@ -86,6 +95,68 @@ namespace engine::core
                 spdlog::warn("目标 FPS 不能为负数。设置为 0（无限制）。");
                 target_fps_ = 0;
             }
+            max_frames_ = perf_config.value("max_frames", max_frames_);
+            if (max_frames_ < 0)
+            {
+                spdlog::warn("最大运行帧数不能为负数。设置为 0（无限制）。");
+                max_frames_ = 0;
+            }
+        }
+        if (j.contains("physics"))
+        {
+            const auto &physics_config = j["physics"];
+            physics_broadphase_ = physics_config.value("broadphase", physics_broadphase_);
+            physics_fixed_timestep_ = physics_config.value("fixed_timestep", physics_fixed_timestep_);
+            physics_step_rate_ = physics_config.value("step_rate", physics_step_rate_);
+            physics_max_steps_per_frame_ = physics_config.value("max_steps_per_frame", physics_max_steps_per_frame_);
+            physics_max_substeps_ = physics_config.value("max_substeps", physics_max_substeps_);
+            physics_substep_distance_ = physics_config.value("substep_distance", physics_substep_distance_);
+            physics_worker_threads_ = physics_config.value("worker_threads", physics_worker_threads_);
+            physics_parallel_threshold_ = physics_config.value("parallel_threshold", physics_parallel_threshold_);
+            physics_deterministic_ = physics_config.value("deterministic", physics_deterministic_);
+            physics_fixed_point_ = physics_config.value("fixed_point", physics_fixed_point_);
+            physics_stats_ = physics_config.value("stats", physics_stats_);
+            physics_stats_history_ = physics_config.value("stats_history", physics_stats_history_);
+            if (physics_step_rate_ <= 0)
+            {
+                spdlog::warn("物理步数必须为正数。设置为 60。");
+                physics_step_rate_ = 60;
+            }
+            if (physics_max_steps_per_frame_ <= 0)
+            {
+                spdlog::warn("单帧最大物理步数必须为正数。设置为 1。");
+                physics_max_steps_per_frame_ = 1;
+            }
+            if (physics_max_substeps_ <= 0)
+            {
+                spdlog::warn("最大子步数必须为正数。设置为 1。");
+                physics_max_substeps_ = 1;
+            }
+            if (physics_substep_distance_ <= 0.0f)
+            {
+                spdlog::warn("子步拆分距离必须为正数。设置为 8.0。");
+                physics_substep_distance_ = 8.0f;
+            }
+            if (physics_worker_threads_ < 0)
+            {
+                spdlog::warn("物理工作线程数不能为负数。设置为 0（只使用串行路径）。");
+                physics_worker_threads_ = 0;
+            }
+            if (physics_parallel_threshold_ <= 0)
+            {
+                spdlog::warn("并行处理的物体数量阈值必须为正数。设置为 256。");
+                physics_parallel_threshold_ = 256;
+            }
+            if (physics_stats_history_ < 0)
+            {
+                spdlog::warn("物理统计历史步数不能为负数。设置为 0（不记录）。");
+                physics_stats_history_ = 0;
+            }
+            if (physics_deterministic_ && !physics_fixed_timestep_)
+            {
+                spdlog::warn("确定性模式需要固定步长。已启用固定步长。");
+                physics_fixed_timestep_ = true;
+            }
         }
         if (j.contains("audio"))
         {
@@ -120,9 +191,60 @@ namespace engine::core
     {
         return nlohmann::ordered_json{
             {"window", {{"title", window_title_}, {"width", window_width_}, {"height", window_height_}, {"resizable", window_resizable_}}},
-            {"graphics", {{"vsync", vsync_enabled_}}},
-            {"performance", {{"target_fps", target_fps_}}},
+            {"graphics", {{"vsync", vsync_enabled_}, {"backend", render_backend_}, {"stats_interval", render_stats_interval_}}},
+            {"performance", {{"target_fps", target_fps_}, {"max_frames", max_frames_}}},
+            {"physics", {{"broadphase", physics_broadphase_},
+                         {"fixed_timestep", physics_fixed_timestep_},
+                         {"step_rate", physics_step_rate_},
+                         {"max_steps_per_frame", physics_max_steps_per_frame_},
+                         {"max_substeps", physics_max_substeps_},
+                         {"substep_distance", physics_substep_distance_},
+                         {"worker_threads", physics_worker_threads_},
+                         {"parallel_threshold", physics_parallel_threshold_},
+                         {"deterministic", physics_deterministic_},
+                         {"fixed_point", physics_fixed_point_},
+                         {"stats", physics_stats_},
+                         {"stats_history", physics_stats_history_}}},
             {"audio", {{"music_volume", music_volume_}, {"sound_volume", sound_volume_}}},
             {"input_mappings", input_mappings_}};
     }
+
+    void Config::applyCommandLine(const std::vector<std::string> &args)
+    {
+        for (const auto &arg : args)
+        {
+            std::string_view view = arg;
+            if (view.starts_with("--renderer="))
+            {
+                render_backend_ = std::string(view.substr(std::string_view("--renderer=").size()));
+                validateRenderBackend();
+                spdlog::info("命令行参数：渲染后端设置为 '{}'", render_backend_);
+            }
+            else if (view.starts_with("--frames="))
+            {
+                auto value = view.substr(std::string_view("--frames=").size());
+                int frames = 0;
+                auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), frames);
+                if (ec != std::errc() || ptr != value.data() + value.size() || frames < 0)
+                {
+                    spdlog::warn("命令行参数 '{}' 无效，已忽略。", arg);
+                    continue;
+                }
+                max_frames_ = frames;
+                spdlog::info("命令行参数：最大运行帧数设置为 {}", max_frames_);
+            }
+            else
+            {
+                spdlog::warn("未知的命令行参数 '{}'，已忽略。", arg);
+            }
+        }
+    }
+    void Config::validateRenderBackend()
+    {
+        if (render_backend_ != "hardware" && render_backend_ != "software" && render_backend_ != "offscreen")
+        {
+            spdlog::warn("未知的渲染后端 '{}'。可选值为 hardware / software / offscreen，设置为 hardware。", render_backend_);
+            render_backend_ = "hardware";
+        }
+    }
 }
@@ -18,10 +18,28 @@ namespace engine::core
         bool window_resizable_ = true;
 
         // 图形设置
-        bool vsync_enabled_ = true; // 是否启用垂直同步
+        bool vsync_enabled_ = true;               // 是否启用垂直同步
+        std::string render_backend_ = "hardware"; // 渲染后端："hardware"（窗口 + 默认渲染器）、"software"（窗口 + 软件渲染器）、
+                                                  // "offscreen"（离屏视频驱动 + 软件渲染器，不需要显示器和 GPU，用于在构建服务器上测量渲染性能）
+        int render_stats_interval_ = 0;           // 每隔多少帧把渲染统计输出到日志（0 表示不输出）
 
         // 性能设置
         int target_fps_ = 144; // 目标 FPS 设置，0 表示不限制
+        int max_frames_ = 0;   // 运行指定帧数后自动退出，0 表示不限制（用于基准测试）
+
+        // 物理设置
+        bool physics_broadphase_ = true;        // 对象碰撞是否使用空间哈希粗检测（false 时两两遍历）
+        bool physics_fixed_timestep_ = true;    // 是否以固定步长运行物理和游戏逻辑（false 时使用可变帧时间）
+        int physics_step_rate_ = 60;            // 固定步长模式下每秒模拟的步数
+        int physics_max_steps_per_frame_ = 5;   // 固定步长模式下单帧最多模拟的步数
+        int physics_max_substeps_ = 4;          // 高速物体瓦片碰撞最多拆分的子步数（1 表示不拆分）
+        float physics_substep_distance_ = 8.0f; // 单步位移超过此距离（像素）时拆分子步
+        int physics_worker_threads_ = 0;        // 并行处理物体的工作线程数（0 表示只使用串行路径）
+        int physics_parallel_threshold_ = 256;  // 物体数量达到此值时才使用并行路径
+        bool physics_deterministic_ = false;    // 确定性模式（强制固定步长，并计算每步的世界状态校验和）
+        bool physics_fixed_point_ = false;      // 是否把每步的位置和速度量化到定点数网格（1/256 像素）
+        bool physics_stats_ = false;            // 是否测量物理各阶段耗时（计数总是统计）
+        int physics_stats_history_ = 0;         // 保留最近多少步的统计历史（0 表示不记录）
 
         // 音频设置
         float music_volume_ = 0.5f;
@@ -48,12 +66,14 @@ namespace engine::core
         Config(Config &&) = delete;
         Config &operator=(Config &&) = delete;
 
-        bool loadFromFile(std::string_view filepath);             // 从指定的 JSON 文件加载配置。成功返回 true，否则返回 false。
-        [[nodiscard]] bool saveToFile(std::string_view filepath); // 当前配置保存到指定的 JSON 文件。成功返回 true，否则返回 false。
+        bool loadFromFile(std::string_view filepath);                // 从指定的 JSON 文件加载配置。成功返回 true，否则返回 false。
+        [[nodiscard]] bool saveToFile(std::string_view filepath);    // 当前配置保存到指定的 JSON 文件。成功返回 true，否则返回 false。
+        void applyCommandLine(const std::vector<std::string> &args); // 用命令行参数覆盖配置（--renderer=<后端>、--frames=<帧数>）。
 
     private:
         void fromJson(const nlohmann::json &j); // 从 JSON 对象反序列化配置。
         nlohmann::ordered_json toJson() const;  // 将当前配置转换为 JSON 对象（按顺序）。
+        void validateRenderBackend();           // 检查渲染后端名称，无效时恢复为 "hardware"。
     };
 
 } // namespace engine::core
\ No newline at end of file
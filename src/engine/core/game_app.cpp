@@ -16,6 +16,7 @@
 #include "../render/text_renderer.h"
 
 #include <spdlog/spdlog.h>
+#include <cmath>
 #include <SDL3/SDL.h>
 
 #include "../input/input_manager.h"
@@ -62,9 +63,23 @@ namespace engine::core // 命名空间与路径一致
             input_manager_->update(); // 每帧显更新输入管理器
 
             handleEvents();
-            update(delta_time);
+            if (config_->physics_fixed_timestep_)
+            {
+                updateFixedSteps(delta_time);
+            }
+            else
+            {
+                update(delta_time);
+            }
             render();
 
+            // 基准测试：运行指定帧数后退出
+            if (config_->max_frames_ > 0 && ++frame_count_ >= static_cast<std::uint64_t>(config_->max_frames_))
+            {
+                spdlog::info("已运行 {} 帧，退出游戏循环", frame_count_);
+                is_running_ = false;
+            }
+
             // spdlog::info("delta_time：{}", delta_time);
         }
         close(); // 离开游戏则清理
@@ -76,6 +91,11 @@ namespace engine::core // 命名空间与路径一致
         spdlog::trace("已注册场景设置函数");
     }
 
+    void GameApp::setCommandLine(int argc, char *argv[])
+    {
+        command_line_.assign(argv + (argc > 0 ? 1 : 0), argv + argc);
+    }
+
     bool GameApp::init()
     {
         spdlog::trace("初始化GameApp……");
@@ -194,6 +214,30 @@ namespace engine::core // 命名空间与路径一致
         scene_manager_->update(delta_time);
     }
 
+    void GameApp::updateFixedSteps(float delta_time)
+    {
+        const float fixed_delta_time = 1.0f / static_cast<float>(config_->physics_step_rate_);
+        accumulator_ += delta_time;
+
+        // 以固定步长推进模拟，单帧步数有上限，防止卡顿后步数越积越多（死亡螺旋）
+        int steps = 0;
+        while (accumulator_ >= fixed_delta_time && steps < config_->physics_max_steps_per_frame_)
+        {
+            update(fixed_delta_time);
+            accumulator_ -= fixed_delta_time;
+            ++steps;
+        }
+        if (accumulator_ >= fixed_delta_time)
+        {
+            spdlog::debug("单帧固定步数达到上限 {}，丢弃 {:.3f} 秒的积压时间", steps, accumulator_);
+            accumulator_ = std::fmod(accumulator_, fixed_delta_time);
+        }
+
+        // 剩余时间占一个步长的比例即为渲染插值因子（非游戏进行中时不插值）
+        float alpha = game_state_->isPlaying() ? accumulator_ / fixed_delta_time : 1.0f;
+        camera_->setInterpolationAlpha(alpha);
+    }
+
     void GameApp::render()
     {
         // TODO 渲染代码
@@ -238,6 +282,7 @@ namespace engine::core // 命名空间与路径一致
         try
         {
             config_ = std::make_unique<engine::core::Config>("assets/config.json");
+            config_->applyCommandLine(command_line_); // 命令行参数优先于配置文件（不会写回配置文件）
         }
         catch (const std::exception &e)
         {
@@ -250,31 +295,45 @@ namespace engine::core // 命名空间与路径一致
 
     bool GameApp::initSDL()
     {
+        // 离屏后端：使用离屏视频驱动和哑音频驱动，不需要显示器和声卡（必须在 SDL_Init 之前设置）
+        const bool offscreen = config_->render_backend_ == "offscreen";
+        if (offscreen)
+        {
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+            SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+        }
+
         if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) // 先看看SDL是否启动成功
         {
             spdlog::error("SDL初始化失败！SDL错误：{}", SDL_GetError());
             return false;
         }
 
-        window_ = SDL_CreateWindow(config_->window_title_.c_str(), config_->window_width_, config_->window_height_, SDL_WINDOW_RESIZABLE); // 尝试启动window_
+        SDL_WindowFlags window_flags = offscreen ? SDL_WINDOW_HIDDEN : SDL_WINDOW_RESIZABLE;
+        window_ = SDL_CreateWindow(config_->window_title_.c_str(), config_->window_width_, config_->window_height_, window_flags); // 尝试启动window_
         if (window_ == nullptr)
         {
             spdlog::error("无法创建窗口！SDL错误：{}", SDL_GetError());
             return false;
         }
 
-        sdl_renderer_ = SDL_CreateRenderer(window_, nullptr); // 尝试把渲染器放入窗口，不限制渲染器(opengl\vulkan)
+        // hardware 不限制渲染器(opengl\vulkan)；software 和 offscreen 使用 SDL 的软件渲染器，在 CPU 上完成全部绘制
+        const char *renderer_name = config_->render_backend_ == "hardware" ? nullptr : SDL_SOFTWARE_RENDERER;
+        sdl_renderer_ = SDL_CreateRenderer(window_, renderer_name); // 尝试把渲染器放入窗口
         if (sdl_renderer_ == nullptr)
         {
             spdlog::error("无法创建渲染器！SDL错误：{}", SDL_GetError());
             return false;
         }
+        spdlog::info("渲染后端：{}，SDL渲染器：{}", config_->render_backend_, SDL_GetRendererName(sdl_renderer_));
         // 设置渲染器支持透明色
         SDL_SetRenderDrawBlendMode(sdl_renderer_, SDL_BLENDMODE_BLEND);
 
-        int vsync_mode = config_->vsync_enabled_ ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
+        // 离屏时没有显示器可以同步
+        auto vsync_enabled = config_->vsync_enabled_ && !offscreen;
+        int vsync_mode = vsync_enabled ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
         SDL_SetRenderVSync(sdl_renderer_, vsync_mode);
-        spdlog::trace("VSync设置为：{}", config_->vsync_enabled_ ? "Enable" : "Disable");
+        spdlog::trace("VSync设置为：{}", vsync_enabled ? "Enable" : "Disable");
 
         SDL_SetRenderLogicalPresentation(sdl_renderer_, config_->window_width_ / 2, config_->window_height_ / 2, SDL_LOGICAL_PRESENTATION_LETTERBOX);
         spdlog::trace("SDL初始化成功");
@@ -335,6 +394,7 @@ namespace engine::core // 命名空间与路径一致
         try
         {
             renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get());
+            renderer_->setStatsLogInterval(config_->render_stats_interval_);
         }
         catch (const std::exception &e)
         {
@@ -364,7 +424,7 @@ namespace engine::core // 命名空间与路径一致
     {
         try
         {
-            text_renderer_ = std::make_unique<engine::render::TextRenderer>(sdl_renderer_, resource_manager_.get());
+            text_renderer_ = std::make_unique<engine::render::TextRenderer>(sdl_renderer_, resource_manager_.get(), renderer_.get());
         }
         catch (const std::exception &e)
         {
@@ -394,6 +454,16 @@ namespace engine::core // 命名空间与路径一致
         try
         {
             physics_engine_ = std::make_unique<engine::physics::PhysicsEngine>();
+            physics_engine_->setBroadphaseEnabled(config_->physics_broadphase_);
+            physics_engine_->setMaxSubsteps(config_->physics_max_substeps_);
+            physics_engine_->setSubstepDistance(config_->physics_substep_distance_);
+            physics_engine_->setWorkerThreadCount(static_cast<size_t>(config_->physics_worker_threads_));
+            physics_engine_->setParallelThreshold(static_cast<size_t>(config_->physics_parallel_threshold_));
+            physics_engine_->setDeterministic(config_->physics_deterministic_);
+            physics_engine_->setFixedDeltaTime(1.0f / static_cast<float>(config_->physics_step_rate_));
+            physics_engine_->setFixedPointEnabled(config_->physics_fixed_point_);
+            physics_engine_->setStatsEnabled(config_->physics_stats_);
+            physics_engine_->setStatsHistorySize(static_cast<size_t>(config_->physics_stats_history_));
         }
         catch (const std::exception &e)
         {
@@ -1,6 +1,9 @@
 #pragma once
 #include <memory>
 #include <functional>
+#include <string>
+#include <vector>
+#include <cstdint>
 
 // 前向声明，减少头文件依赖，加速编译
 struct SDL_Window;
@@ -51,6 +54,9 @@ namespace engine::core // 命名空间与路径一致
         SDL_Window *window_ = nullptr;
         SDL_Renderer *sdl_renderer_ = nullptr;
         bool is_running_ = false;
+        float accumulator_ = 0.0f;              // 固定步长模式下累积的未模拟时间（秒）
+        std::uint64_t frame_count_ = 0;         // 已运行的帧数（达到配置的最大帧数时退出）
+        std::vector<std::string> command_line_; // 命令行参数（不含程序名），加载配置后用于覆盖配置
 
         // 场景设置函数，用于在游戏前设置初始场景（GameApp）不负责决定初始场景
         std::function<void(engine::scene::SceneManager &)> scene_setup_func_;
@@ -76,6 +82,7 @@ namespace engine::core // 命名空间与路径一致
         void run();
 
         void registerSceneSetup(std::function<void(engine::scene::SceneManager &)> func);
+        void setCommandLine(int argc, char *argv[]); // 记录命令行参数（在 run 之前调用），例如 --renderer=offscreen --frames=600
 
         // 由于不需要移动构造和复制构造等内容，此处做delete处理
         GameApp(const GameApp &) = delete;
@@ -87,6 +94,7 @@ namespace engine::core // 命名空间与路径一致
         [[nodiscard]] bool init(); // discard表示不可忽略，必须处理
         void handleEvents();
         void update(float delta_time);
+        void updateFixedSteps(float delta_time); // 固定步长模式：用累积时间驱动若干次 update，并设置渲染插值因子
         void render();
         void close();
 
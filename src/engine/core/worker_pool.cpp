@@ -0,0 +1,98 @@
+#include "worker_pool.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::core
+{
+
+    WorkerPool::WorkerPool(size_t thread_count)
+    {
+        threads_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+        {
+            threads_.emplace_back(&WorkerPool::workerLoop, this, i);
+        }
+        spdlog::trace("WorkerPool 创建完成，工作线程数: {}", thread_count);
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        start_cv_.notify_all();
+        for (auto &thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    void WorkerPool::parallelFor(size_t count, const std::function<void(size_t, size_t)> &task)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        // 没有工作线程时直接在调用线程执行
+        if (threads_.empty())
+        {
+            task(0, count);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            task_count_ = count;
+            pending_ = threads_.size();
+            ++generation_;
+        }
+        start_cv_.notify_all();
+
+        // 调用线程处理第 0 段，工作线程处理其余各段
+        runChunk(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]
+                      { return pending_ == 0; });
+        task_ = nullptr;
+    }
+
+    void WorkerPool::workerLoop(size_t worker_index)
+    {
+        std::uint64_t seen_generation = 0;
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [this, seen_generation]
+                           { return stopping_ || generation_ != seen_generation; });
+            if (stopping_)
+            {
+                return;
+            }
+            seen_generation = generation_;
+            lock.unlock();
+
+            runChunk(worker_index + 1);
+
+            lock.lock();
+            if (--pending_ == 0)
+            {
+                done_cv_.notify_one();
+            }
+        }
+    }
+
+    void WorkerPool::runChunk(size_t chunk_index)
+    {
+        // 任务状态在 parallelFor 返回前不会改变，这里无需加锁读取
+        auto chunk_count = threads_.size() + 1;
+        auto begin = task_count_ * chunk_index / chunk_count;
+        auto end = task_count_ * (chunk_index + 1) / chunk_count;
+        if (begin < end)
+        {
+            (*task_)(begin, end);
+        }
+    }
+
+} // namespace engine::core
@@ -0,0 +1,60 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine::core
+{
+
+    /**
+     * @brief 固定数量的工作线程池，用于把一段连续下标的工作拆分到多个线程并行执行。
+     *
+     * 调用线程本身也会处理其中一段，parallelFor 在所有分段完成后才返回。
+     * 分段方式只取决于任务数量和线程数，同样的输入总是得到同样的划分。
+     */
+    class WorkerPool final
+    {
+    private:
+        std::vector<std::thread> threads_;                          ///< @brief 工作线程
+        std::mutex mutex_;                                          ///< @brief 保护以下任务状态
+        std::condition_variable start_cv_;                          ///< @brief 通知工作线程开始新任务
+        std::condition_variable done_cv_;                           ///< @brief 通知调用线程所有分段已完成
+        const std::function<void(size_t, size_t)> *task_ = nullptr; ///< @brief 当前任务（仅在 parallelFor 期间有效）
+        size_t task_count_ = 0;                                     ///< @brief 当前任务的总下标数
+        std::uint64_t generation_ = 0;                              ///< @brief 任务代数，每次 parallelFor 加一
+        size_t pending_ = 0;                                        ///< @brief 尚未完成的工作线程数
+        bool stopping_ = false;                                     ///< @brief 是否正在销毁线程池
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param thread_count 工作线程数量（不含调用线程）
+         */
+        explicit WorkerPool(size_t thread_count);
+        ~WorkerPool();
+
+        // 禁止拷贝和移动
+        WorkerPool(const WorkerPool &) = delete;
+        WorkerPool &operator=(const WorkerPool &) = delete;
+        WorkerPool(WorkerPool &&) = delete;
+        WorkerPool &operator=(WorkerPool &&) = delete;
+
+        size_t getThreadCount() const { return threads_.size(); } ///< @brief 获取工作线程数量
+
+        /**
+         * @brief 把 [0, count) 平均划分为 (工作线程数 + 1) 段并行执行，全部完成后返回。
+         * @param count 下标总数
+         * @param task 处理 [begin, end) 区间的函数，不同区间会在不同线程上同时调用
+         */
+        void parallelFor(size_t count, const std::function<void(size_t, size_t)> &task);
+
+    private:
+        void workerLoop(size_t worker_index); ///< @brief 工作线程主循环
+        void runChunk(size_t chunk_index);    ///< @brief 执行第 chunk_index 段
+    };
+
+} // namespace engine::core
@@ -13,19 +13,19 @@ namespace engine::object
 
     void GameObject::update(float delta_time, engine::core::Context &context)
     {
-        // 遍历所有组件并调用它们的 update 方法
-        for (auto &pair : components_)
+        // 按添加顺序遍历所有组件并调用它们的 update 方法 (使用下标，组件在更新中添加新组件也是安全的)
+        for (size_t i = 0; i < component_order_.size(); ++i)
         {
-            pair.second->update(delta_time, context);
+            component_order_[i]->update(delta_time, context);
         }
     }
 
     void GameObject::render(engine::core::Context &context)
     {
         // 遍历所有组件并调用它们的 render 方法
-        for (auto &pair : components_)
+        for (size_t i = 0; i < component_order_.size(); ++i)
         {
-            pair.second->render(context);
+            component_order_[i]->render(context);
         }
     }
 
@@ -33,19 +33,20 @@ namespace engine::object
     {
         spdlog::trace("Cleaning GameObject...");
         // 遍历所有组件并调用它们的 clean 方法
-        for (auto &pair : components_)
+        for (size_t i = 0; i < component_order_.size(); ++i)
         {
-            pair.second->clean();
+            component_order_[i]->clean();
         }
+        component_order_.clear();
         components_.clear(); // 清空 map, unique_ptr 会自动释放内存
     }
 
     void GameObject::handleInput(engine::core::Context &context)
     {
         // 遍历所有组件并调用它们的 handleInput 方法
-        for (auto &pair : components_)
+        for (size_t i = 0; i < component_order_.size(); ++i)
         {
-            pair.second->handleInput(context);
+            component_order_[i]->handleInput(context);
         }
     }
 
@@ -3,8 +3,11 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
+#include <algorithm>
 #include <typeindex> // 用于类型索引
 #include <utility>   // 用于完美转发
+#include <type_traits>
 #include <spdlog/spdlog.h>
 
 namespace engine::core
@@ -12,6 +15,11 @@ namespace engine::core
     class Context;
 }
 
+namespace engine::component
+{
+    class TransformComponent;
+}
+
 namespace engine::object
 {
 
@@ -27,7 +35,10 @@ namespace engine::object
         std::string name_;                                                                              // 名称
         std::string tag_;                                                                               // 标签
         std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> components_; // 组件列表
+        std::vector<engine::component::Component *> component_order_;                                   // 按添加顺序排列的组件（遍历时使用，保证顺序确定）
         bool need_remove_ = false;                                                                      // 延迟删除的标识，将来由场景类负责删除
+        int render_layer_ = -1;                                                                         // 渲染层（Tiled 图层序号，-1 表示加入场景时使用场景当前的最高层）
+        engine::component::TransformComponent *transform_ = nullptr;                                    // 缓存的 Transform 组件（每个固定步都要访问，避免哈希查找）
 
     public:
         GameObject(std::string_view name = "", std::string_view tag = ""); // 构造函数。默认名称为空，标签为空
@@ -45,6 +56,9 @@ namespace engine::object
         std::string_view getTag() const { return tag_; }                     // 获取标签
         void setNeedRemove(bool need_remove) { need_remove_ = need_remove; } // 设置是否需要删除
         bool isNeedRemove() const { return need_remove_; }                   // 获取是否需要删除
+        void setRenderLayer(int layer) { render_layer_ = layer; }            // 设置渲染层
+        int getRenderLayer() const { return render_layer_; }                 // 获取渲染层
+        engine::component::TransformComponent *getTransform() const { return transform_; } // 获取 Transform 组件（等同于 getComponent，但不需要查找）
 
         /**
          * @brief 添加组件 (里面会完成组件的init())
@@ -76,6 +90,11 @@ namespace engine::object
             T *ptr = new_component.get();                       // 先获取裸指针以便返回
             new_component->setOwner(this);                      // 设置组件的拥有者
             components_[type_index] = std::move(new_component); // 移动组件   （new_component 变为空，不可再使用）
+            component_order_.push_back(ptr);                    // 记录添加顺序
+            if constexpr (std::is_same_v<T, engine::component::TransformComponent>)
+            {
+                transform_ = ptr;
+            }
             ptr->init();                                        // 初始化组件 （因此必须用ptr而不能用new_component）
             spdlog::debug("GameObject::addComponent: {} added component {}", name_, typeid(T).name());
             return ptr; // 返回非拥有指针
@@ -129,6 +148,11 @@ namespace engine::object
             if (it != components_.end())
             {
                 it->second->clean();
+                component_order_.erase(std::remove(component_order_.begin(), component_order_.end(), it->second.get()), component_order_.end());
+                if constexpr (std::is_same_v<T, engine::component::TransformComponent>)
+                {
+                    transform_ = nullptr;
+                }
                 components_.erase(it);
             }
         }
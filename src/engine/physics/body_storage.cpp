@@ -0,0 +1,52 @@
+#include "body_storage.h"
+
+namespace engine::physics
+{
+
+    size_t BodyStorage::add(engine::component::PhysicsComponent *component, float mass, bool gravity)
+    {
+        components.push_back(component);
+        transforms.push_back(nullptr);
+        colliders.push_back(nullptr);
+        positions.emplace_back(0.0f, 0.0f);
+        velocities.emplace_back(0.0f, 0.0f);
+        forces.emplace_back(0.0f, 0.0f);
+        masses.push_back(mass);
+        use_gravity.push_back(gravity ? 1 : 0);
+        enabled.push_back(1);
+        flags.push_back(0);
+        collider_flags.push_back(0);
+        aabb_offsets.emplace_back(0.0f, 0.0f);
+        aabb_sizes.emplace_back(0.0f, 0.0f);
+        types.push_back(BodyType::DYNAMIC);
+        sleeping.push_back(0);
+        sleep_timers.push_back(0.0f);
+        return components.size() - 1;
+    }
+
+    void BodyStorage::erase(size_t index)
+    {
+        if (index >= size())
+        {
+            return;
+        }
+        auto offset = static_cast<std::ptrdiff_t>(index);
+        components.erase(components.begin() + offset);
+        transforms.erase(transforms.begin() + offset);
+        colliders.erase(colliders.begin() + offset);
+        positions.erase(positions.begin() + offset);
+        velocities.erase(velocities.begin() + offset);
+        forces.erase(forces.begin() + offset);
+        masses.erase(masses.begin() + offset);
+        use_gravity.erase(use_gravity.begin() + offset);
+        enabled.erase(enabled.begin() + offset);
+        flags.erase(flags.begin() + offset);
+        collider_flags.erase(collider_flags.begin() + offset);
+        aabb_offsets.erase(aabb_offsets.begin() + offset);
+        aabb_sizes.erase(aabb_sizes.begin() + offset);
+        types.erase(types.begin() + offset);
+        sleeping.erase(sleeping.begin() + offset);
+        sleep_timers.erase(sleep_timers.begin() + offset);
+    }
+
+} // namespace engine::physics
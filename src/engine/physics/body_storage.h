@@ -0,0 +1,106 @@
+#pragma once
+#include "../utils/math.h"
+#include <glm/vec2.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine::component
+{
+    class PhysicsComponent;
+    class TransformComponent;
+    class ColliderComponent;
+}
+
+namespace engine::physics
+{
+
+    /**
+     * @brief 物体类型。
+     */
+    enum class BodyType : std::uint8_t
+    {
+        DYNAMIC,   ///< @brief 动态物体：受力和重力影响，参与瓦片碰撞，静止一段时间后自动休眠
+        KINEMATIC, ///< @brief 运动学物体：只按速度移动，不受力和重力影响，不参与瓦片碰撞，也不会被推开
+        STATIC,    ///< @brief 静态物体：从不移动（如 SOLID 箱子、道具、触发区域），跳过所有模拟步骤
+    };
+
+    /// @brief 物体碰撞状态标志位（每次物理更新开始时清零）
+    namespace body_flag
+    {
+        constexpr std::uint8_t COLLIDED_BELOW = 1u << 0;
+        constexpr std::uint8_t COLLIDED_ABOVE = 1u << 1;
+        constexpr std::uint8_t COLLIDED_LEFT = 1u << 2;
+        constexpr std::uint8_t COLLIDED_RIGHT = 1u << 3;
+        constexpr std::uint8_t COLLIDED_LADDER = 1u << 4; ///< @brief 与梯子发生碰撞
+        constexpr std::uint8_t ON_TOP_LADDER = 1u << 5;   ///< @brief 在梯子顶层（梯子上方没有瓦片）
+    } // namespace body_flag
+
+    /// @brief 物体碰撞器状态位（每次物理更新开始时从 ColliderComponent 同步）
+    namespace collider_flag
+    {
+        constexpr std::uint8_t PRESENT = 1u << 0; ///< @brief 拥有有效的碰撞器
+        constexpr std::uint8_t ACTIVE = 1u << 1;  ///< @brief 碰撞器已激活
+        constexpr std::uint8_t TRIGGER = 1u << 2; ///< @brief 碰撞器是触发器
+    } // namespace collider_flag
+
+    /**
+     * @brief 以结构数组（SoA）形式紧凑存储所有物体的模拟数据。
+     *
+     * 所有数组长度相同，同一下标对应同一个物体，PhysicsComponent 只保存自己的下标。
+     * 移除物体时保持其余物体的相对顺序（并更新它们的下标），保证模拟顺序与注册顺序一致。
+     */
+    struct BodyStorage final
+    {
+        // --- 所属组件（非拥有指针，注册时缓存，避免每帧查找） ---
+        std::vector<engine::component::PhysicsComponent *> components;
+        std::vector<engine::component::TransformComponent *> transforms;
+        std::vector<engine::component::ColliderComponent *> colliders;
+
+        // --- 模拟数据 ---
+        std::vector<glm::vec2> positions;  ///< @brief Transform 位置（每次更新开始时读取，结束时写回）
+        std::vector<glm::vec2> velocities; ///< @brief 速度 (像素/秒)
+        std::vector<glm::vec2> forces;     ///< @brief 当前帧受到的力
+        std::vector<float> masses;         ///< @brief 质量
+        std::vector<std::uint8_t> use_gravity;
+        std::vector<std::uint8_t> enabled;
+        std::vector<std::uint8_t> flags;          ///< @brief body_flag 碰撞状态位
+        std::vector<std::uint8_t> collider_flags; ///< @brief collider_flag 碰撞器状态位
+        std::vector<glm::vec2> aabb_offsets;      ///< @brief 碰撞盒左上角相对于 Transform 位置的偏移（缓存）
+        std::vector<glm::vec2> aabb_sizes;        ///< @brief 碰撞盒尺寸（已应用缩放，缓存）
+        std::vector<BodyType> types;              ///< @brief 物体类型
+        std::vector<std::uint8_t> sleeping;       ///< @brief 是否处于休眠状态（仅动态物体）
+        std::vector<float> sleep_timers;          ///< @brief 动态物体连续静止的时间（秒）
+
+        size_t size() const { return components.size(); }
+
+        /**
+         * @brief 在末尾添加一个物体。
+         * @return 新物体的下标。
+         */
+        size_t add(engine::component::PhysicsComponent *component, float mass, bool gravity);
+
+        /// @brief 按顺序移除指定下标的物体，其后所有物体的下标减一。
+        void erase(size_t index);
+
+        /// @brief 唤醒物体（清除休眠状态和静止计时）
+        void wake(size_t index)
+        {
+            sleeping[index] = 0;
+            sleep_timers[index] = 0.0f;
+        }
+
+        /// @brief 物体本步是否会移动（非静态且未休眠）
+        bool isMoving(size_t index) const
+        {
+            return types[index] != BodyType::STATIC && !sleeping[index];
+        }
+
+        /// @brief 获取物体当前的世界坐标碰撞盒（由缓存的位置和偏移计算）。
+        engine::utils::Rect getWorldAABB(size_t index) const
+        {
+            return {positions[index] + aabb_offsets[index], aabb_sizes[index]};
+        }
+    };
+
+} // namespace engine::physics
@@ -0,0 +1,75 @@
+#include "collider.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+#include <glm/common.hpp>
+
+namespace engine::physics
+{
+
+    namespace
+    {
+        /// @brief 二维叉积 (b - a) x (c - a)
+        float cross(const glm::vec2 &a, const glm::vec2 &b, const glm::vec2 &c)
+        {
+            return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        }
+    } // namespace
+
+    PolygonCollider::PolygonCollider(std::vector<glm::vec2> vertices)
+    {
+        if (vertices.size() < 3)
+        {
+            spdlog::warn("多边形碰撞器的顶点数量不足 ({})，将无法产生碰撞。", vertices.size());
+        }
+        auto input_count = vertices.size();
+
+        // 计算凸包 (Andrew 单调链算法)，同时去掉重复和共线的顶点
+        std::sort(vertices.begin(), vertices.end(), [](const glm::vec2 &a, const glm::vec2 &b)
+                  { return a.x < b.x || (a.x == b.x && a.y < b.y); });
+        vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+        if (vertices.size() >= 3)
+        {
+            std::vector<glm::vec2> hull(vertices.size() * 2);
+            size_t k = 0;
+            for (size_t i = 0; i < vertices.size(); ++i) // 下半部分
+            {
+                while (k >= 2 && cross(hull[k - 2], hull[k - 1], vertices[i]) <= 0.0f)
+                    --k;
+                hull[k++] = vertices[i];
+            }
+            for (size_t i = vertices.size() - 1, lower = k + 1; i > 0; --i) // 上半部分
+            {
+                while (k >= lower && cross(hull[k - 2], hull[k - 1], vertices[i - 1]) <= 0.0f)
+                    --k;
+                hull[k++] = vertices[i - 1];
+            }
+            hull.resize(k - 1); // 最后一个顶点与第一个重复
+            vertices = std::move(hull);
+        }
+        if (vertices.size() != input_count)
+        {
+            spdlog::debug("多边形碰撞器的顶点已替换为凸包，顶点数: {} -> {}", input_count, vertices.size());
+        }
+
+        // 缓存最小包围盒，并把顶点平移到包围盒左上角为原点的坐标系
+        if (vertices.empty())
+        {
+            return;
+        }
+        glm::vec2 min_point = vertices.front();
+        glm::vec2 max_point = vertices.front();
+        for (const auto &vertex : vertices)
+        {
+            min_point = glm::min(min_point, vertex);
+            max_point = glm::max(max_point, vertex);
+        }
+        for (auto &vertex : vertices)
+        {
+            vertex -= min_point;
+        }
+        vertices_ = std::move(vertices);
+        vertex_origin_ = min_point;
+        setAABBSize(max_point - min_point);
+    }
+
+} // namespace engine::physics
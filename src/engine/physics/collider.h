@@ -1,6 +1,8 @@
 #pragma once
 #include <glm/vec2.hpp>
 #include <utility>
+#include <vector>
+#include <cstdint>
 
 namespace engine::physics
 {
@@ -13,9 +15,30 @@ namespace engine::physics
         NONE,
         AABB,
         CIRCLE,
-        // 未来可能添加其他类型，如 Capsule, Polygon 等
+        POLYGON, ///< @brief 凸多边形
+        CAPSULE, ///< @brief 胶囊体（内切于包围盒，沿较长的一边延伸）
+        ELLIPSE, ///< @brief 椭圆（内切于包围盒）
     };
 
+    /**
+     * @brief 碰撞类别位。
+     *
+     * 每个碰撞器拥有一个类别位（category）和一个掩码（mask），
+     * 只有双方的类别都在对方掩码内时才会进行精确碰撞检测。
+     */
+    namespace category
+    {
+        constexpr std::uint32_t NONE = 0;
+        constexpr std::uint32_t DEFAULT = 1u << 0; ///< @brief 未指定类别的对象
+        constexpr std::uint32_t SOLID = 1u << 1;   ///< @brief SOLID 物体，会把可移动物体推开
+        constexpr std::uint32_t PLAYER = 1u << 2;  ///< @brief 玩家
+        constexpr std::uint32_t ENEMY = 1u << 3;   ///< @brief 敌人
+        constexpr std::uint32_t ITEM = 1u << 4;    ///< @brief 道具
+        constexpr std::uint32_t HAZARD = 1u << 5;  ///< @brief 危险物体（如尖刺）
+        constexpr std::uint32_t TRIGGER = 1u << 6; ///< @brief 触发区域（如关底、终点）
+        constexpr std::uint32_t ALL = 0xFFFFFFFFu;
+    } // namespace category
+
     /**
      * @brief 碰撞器的抽象基类。
      * 所有具体的碰撞器都应继承此类。
@@ -77,4 +100,62 @@ namespace engine::physics
         void setRadius(float radius) { radius_ = radius; }
     };
 
+    /**
+     * @brief 凸多边形碰撞器。
+     *
+     * 顶点坐标以最小包围盒左上角为原点，构造时会计算传入顶点的凸包（非凸多边形会被替换为凸包），
+     * 并平移顶点使包围盒从 (0, 0) 开始，原来的包围盒左上角可以通过 getVertexOrigin() 获取。
+     */
+    class PolygonCollider final : public Collider
+    {
+    private:
+        std::vector<glm::vec2> vertices_;        ///< @brief 凸包顶点（按顺序排列，相对于包围盒左上角）
+        glm::vec2 vertex_origin_ = {0.0f, 0.0f}; ///< @brief 传入顶点的包围盒左上角（在传入顶点的坐标系中）
+
+    public:
+        /**
+         * @brief 构造函数。
+         * @param vertices 多边形顶点，可以使用任意原点。
+         */
+        explicit PolygonCollider(std::vector<glm::vec2> vertices);
+        ~PolygonCollider() override = default;
+
+        // --- Getters ---
+        ColliderType getType() const override { return ColliderType::POLYGON; }
+        const std::vector<glm::vec2> &getVertices() const { return vertices_; }
+        const glm::vec2 &getVertexOrigin() const { return vertex_origin_; }
+    };
+
+    /**
+     * @brief 胶囊体碰撞器：两端为半圆，半径为包围盒较短一边的一半。
+     */
+    class CapsuleCollider final : public Collider
+    {
+    public:
+        /**
+         * @brief 构造函数。
+         * @param size 包围盒的宽度和高度（宽大于高时为横向胶囊，否则为纵向胶囊）。
+         */
+        explicit CapsuleCollider(glm::vec2 size) { setAABBSize(size); }
+        ~CapsuleCollider() override = default;
+
+        ColliderType getType() const override { return ColliderType::CAPSULE; }
+    };
+
+    /**
+     * @brief 椭圆碰撞器：内切于包围盒，两条半轴分别为包围盒宽高的一半。
+     */
+    class EllipseCollider final : public Collider
+    {
+    public:
+        /**
+         * @brief 构造函数。
+         * @param size 包围盒的宽度和高度。
+         */
+        explicit EllipseCollider(glm::vec2 size) { setAABBSize(size); }
+        ~EllipseCollider() override = default;
+
+        ColliderType getType() const override { return ColliderType::ELLIPSE; }
+    };
+
 } // namespace engine::physics
\ No newline at end of file
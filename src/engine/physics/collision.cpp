@@ -1,10 +1,188 @@
 #include "collision.h"
 #include "../component/collider_component.h"
 #include "../component/transform_component.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
 
 namespace engine::physics::collision
 {
 
+    namespace
+    {
+        /**
+         * @brief 世界坐标系下的碰撞形状，所有形状都由（已缩放的）最小包围盒确定。
+         */
+        struct WorldShape
+        {
+            ColliderType type = ColliderType::NONE;   ///< @brief 形状类型
+            glm::vec2 pos = {0.0f, 0.0f};             ///< @brief 包围盒左上角
+            glm::vec2 size = {0.0f, 0.0f};            ///< @brief 包围盒尺寸（已缩放）
+            glm::vec2 scale = {1.0f, 1.0f};           ///< @brief Transform 缩放（多边形顶点需要）
+            const PolygonCollider *polygon = nullptr; ///< @brief 多边形碰撞器（仅 POLYGON 类型）
+        };
+
+        constexpr int GJK_MAX_ITERATIONS = 32; ///< @brief GJK 最大迭代次数（二维凸形状通常几次就能收敛）
+
+        glm::vec2 perpendicular(const glm::vec2 &v) { return {-v.y, v.x}; }
+
+        /// @brief 形状在 direction 方向上最远的点（支撑点）
+        glm::vec2 getSupportPoint(const WorldShape &shape, const glm::vec2 &direction)
+        {
+            auto center = shape.pos + 0.5f * shape.size;
+            auto length = glm::length(direction);
+            auto unit = length > 0.0f ? direction / length : glm::vec2(0.0f);
+            switch (shape.type)
+            {
+            case ColliderType::CIRCLE:
+                return center + 0.5f * shape.size.x * unit;
+            case ColliderType::CAPSULE:
+            {
+                // 胶囊体 = 中心线段 + 半径
+                auto radius = 0.5f * std::min(shape.size.x, shape.size.y);
+                auto axis = shape.size.x >= shape.size.y ? glm::vec2(0.5f * shape.size.x - radius, 0.0f)
+                                                         : glm::vec2(0.0f, 0.5f * shape.size.y - radius);
+                auto end = glm::dot(direction, axis) >= 0.0f ? center + axis : center - axis;
+                return end + radius * unit;
+            }
+            case ColliderType::ELLIPSE:
+            {
+                auto radii = 0.5f * shape.size;
+                auto scaled = radii * radii * direction;
+                auto denom = std::sqrt(glm::dot(scaled, direction));
+                return denom > 0.0f ? center + scaled / denom : center;
+            }
+            case ColliderType::POLYGON:
+            {
+                auto best = shape.pos;
+                auto best_dot = -std::numeric_limits<float>::infinity();
+                for (const auto &vertex : shape.polygon->getVertices())
+                {
+                    auto point = shape.pos + vertex * shape.scale;
+                    if (auto d = glm::dot(point, direction); d > best_dot)
+                    {
+                        best_dot = d;
+                        best = point;
+                    }
+                }
+                return best;
+            }
+            default: // AABB
+                return shape.pos + glm::vec2(direction.x > 0.0f ? shape.size.x : 0.0f, direction.y > 0.0f ? shape.size.y : 0.0f);
+            }
+        }
+
+        /**
+         * @brief 分离轴定理：检查 other 是否在多边形某条边的法线方向上与之分离。
+         * @note 包围盒的 x/y 轴已经由最小包围盒检测覆盖，这里只需检测多边形自身的边。
+         */
+        bool isSeparatedOnPolygonAxes(const WorldShape &polygon, const WorldShape &other)
+        {
+            const auto &vertices = polygon.polygon->getVertices();
+            for (size_t i = 0; i < vertices.size(); ++i)
+            {
+                auto edge = (vertices[(i + 1) % vertices.size()] - vertices[i]) * polygon.scale;
+                auto axis = perpendicular(edge);
+                if (axis.x == 0.0f && axis.y == 0.0f)
+                    continue;
+                auto min_a = std::numeric_limits<float>::infinity();
+                auto max_a = -std::numeric_limits<float>::infinity();
+                for (const auto &vertex : vertices)
+                {
+                    auto d = glm::dot(polygon.pos + vertex * polygon.scale, axis);
+                    min_a = std::min(min_a, d);
+                    max_a = std::max(max_a, d);
+                }
+                auto min_b = glm::dot(getSupportPoint(other, -axis), axis);
+                auto max_b = glm::dot(getSupportPoint(other, axis), axis);
+                if (max_a <= min_b || max_b <= min_a)
+                    return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief GJK 算法：检查两个凸形状的闵可夫斯基差是否包含原点。
+         * 只接触不算重叠，与 AABB 检测的规则一致。
+         */
+        bool checkGJKOverlap(const WorldShape &a, const WorldShape &b)
+        {
+            auto support = [&](const glm::vec2 &d)
+            { return getSupportPoint(a, d) - getSupportPoint(b, -d); };
+
+            glm::vec2 simplex[3];
+            int count = 0;
+            auto direction = (b.pos + 0.5f * b.size) - (a.pos + 0.5f * a.size);
+            if (direction.x == 0.0f && direction.y == 0.0f)
+                direction = {1.0f, 0.0f};
+            simplex[count++] = support(direction);
+            direction = -simplex[0];
+
+            for (int iteration = 0; iteration < GJK_MAX_ITERATIONS; ++iteration)
+            {
+                if (direction.x == 0.0f && direction.y == 0.0f)
+                    return true; // 原点在单纯形上
+                auto point = support(direction);
+                if (glm::dot(point, direction) <= 0.0f)
+                    return false; // 新的支撑点没有越过原点，存在分离方向
+                simplex[count++] = point;
+
+                if (count == 2)
+                {
+                    // 线段：A 为最新的点，朝原点所在一侧寻找下一个方向
+                    auto a_point = simplex[1];
+                    auto ab = simplex[0] - a_point;
+                    auto ao = -a_point;
+                    if (glm::dot(ab, ao) > 0.0f)
+                    {
+                        direction = perpendicular(ab);
+                        if (glm::dot(direction, ao) < 0.0f)
+                            direction = -direction;
+                    }
+                    else
+                    {
+                        simplex[0] = a_point;
+                        count = 1;
+                        direction = ao;
+                    }
+                }
+                else
+                {
+                    // 三角形：A 为最新的点，检查原点在 AB、AC 哪条边之外
+                    auto a_point = simplex[2];
+                    auto ab = simplex[1] - a_point;
+                    auto ac = simplex[0] - a_point;
+                    auto ao = -a_point;
+                    auto ab_perp = perpendicular(ab);
+                    if (glm::dot(ab_perp, ac) > 0.0f)
+                        ab_perp = -ab_perp;
+                    auto ac_perp = perpendicular(ac);
+                    if (glm::dot(ac_perp, ab) > 0.0f)
+                        ac_perp = -ac_perp;
+
+                    if (glm::dot(ab_perp, ao) > 0.0f)
+                    {
+                        simplex[0] = simplex[1]; // 去掉 C
+                        simplex[1] = a_point;
+                        count = 2;
+                        direction = ab_perp;
+                    }
+                    else if (glm::dot(ac_perp, ao) > 0.0f)
+                    {
+                        simplex[1] = a_point; // 去掉 B
+                        count = 2;
+                        direction = ac_perp;
+                    }
+                    else
+                    {
+                        return true; // 原点在三角形内
+                    }
+                }
+            }
+            return true; // 未收敛时保守地视为重叠
+        }
+    } // namespace
+
     bool checkCollision(const engine::component::ColliderComponent &a, const engine::component::ColliderComponent &b)
     {
         // 获取两个碰撞盒及对应Transform信息
@@ -54,7 +232,25 @@ namespace engine::physics::collision
             auto nearest_point = glm::clamp(a_center, b_pos, b_pos + b_size); // 计算圆心到AABB的最邻近点
             return checkPointInCircle(nearest_point, a_center, a_radius);
         }
-        return false;
+
+        // --- 其它组合：多边形与 AABB / 多边形之间使用分离轴定理，包含曲线形状时使用 GJK ---
+        WorldShape a_shape{a_collider->getType(), a_pos, a_size, a_transform->getScale(), dynamic_cast<const PolygonCollider *>(a_collider)};
+        WorldShape b_shape{b_collider->getType(), b_pos, b_size, b_transform->getScale(), dynamic_cast<const PolygonCollider *>(b_collider)};
+        if (a_shape.type == ColliderType::NONE || b_shape.type == ColliderType::NONE)
+        {
+            return false;
+        }
+        auto is_flat = [](const WorldShape &shape)
+        { return shape.type == ColliderType::AABB || shape.type == ColliderType::POLYGON; };
+        if (is_flat(a_shape) && is_flat(b_shape))
+        {
+            if (a_shape.polygon && isSeparatedOnPolygonAxes(a_shape, b_shape))
+                return false;
+            if (b_shape.polygon && isSeparatedOnPolygonAxes(b_shape, a_shape))
+                return false;
+            return true;
+        }
+        return checkGJKOverlap(a_shape, b_shape);
     }
 
     bool checkCircleOverlap(const glm::vec2 &a_center, const float a_radius, const glm::vec2 &b_center, const float b_radius)
@@ -0,0 +1,199 @@
+#include "collision_grid.h"
+#include "height_profile_table.h"
+#include "../component/tilelayer_component.h"
+#include <spdlog/spdlog.h>
+#include <glm/common.hpp>
+
+namespace engine::physics
+{
+
+    void CollisionGrid::rebuild(const std::vector<engine::component::TileLayerComponent *> &layers)
+    {
+        clear();
+        // 确定瓦片尺寸和网格尺寸
+        for (const auto *layer : layers)
+        {
+            if (!layer)
+                continue;
+            if (tile_size_.x <= 0 || tile_size_.y <= 0)
+            {
+                tile_size_ = layer->getTileSize();
+            }
+            if (layer->getTileSize() == tile_size_)
+            {
+                map_size_ = glm::max(map_size_, layer->getMapSize());
+            }
+        }
+        if (empty() || tile_size_.x <= 0 || tile_size_.y <= 0)
+        {
+            clear();
+            return;
+        }
+
+        stride_ = map_size_.x + 2 * PADDING;
+        cells_.assign(static_cast<size_t>(stride_) * (map_size_.y + 2 * PADDING), static_cast<std::uint8_t>(engine::component::TileType::EMPTY));
+        profiles_.assign(cells_.size(), HeightProfileTable::NONE);
+        triggers_.assign(cells_.size(), 0);
+
+        // 逐层合并瓦片类型
+        for (const auto *layer : layers)
+        {
+            if (!layer)
+                continue;
+            if (layer->getTileSize() != tile_size_)
+            {
+                spdlog::warn("碰撞瓦片图层的瓦片尺寸 ({}, {}) 与碰撞网格 ({}, {}) 不一致，已忽略。",
+                             layer->getTileSize().x, layer->getTileSize().y, tile_size_.x, tile_size_.y);
+                continue;
+            }
+            const auto &tiles = layer->getTiles();
+            auto layer_size = layer->getMapSize();
+            for (int y = 0; y < layer_size.y; ++y)
+            {
+                for (int x = 0; x < layer_size.x; ++x)
+                {
+                    auto index = static_cast<size_t>(y) * layer_size.x + x;
+                    if (index >= tiles.size())
+                        continue;
+                    auto cell_index = static_cast<size_t>(y + PADDING) * stride_ + x + PADDING;
+                    auto &cell = cells_[cell_index];
+                    const auto &tile = tiles[index];
+                    // 触发器瓦片在所有图层上都要记录，即使该格子合并后是其它类型
+                    if (tile.type == engine::component::TileType::HAZARD)
+                        triggers_[cell_index] |= TRIGGER_HAZARD;
+                    else if (tile.type == engine::component::TileType::LADDER)
+                        triggers_[cell_index] |= TRIGGER_LADDER;
+                    if (getMergePriority(tile.type) > getMergePriority(static_cast<engine::component::TileType>(cell)))
+                    {
+                        cell = static_cast<std::uint8_t>(tile.type);
+                        // 只有斜坡瓦片有高度轮廓
+                        auto profile = tile.height_profile != HeightProfileTable::NONE ? tile.height_profile : HeightProfileTable::getDefaultProfile(tile.type);
+                        profiles_[cell_index] = HeightProfileTable::isSlope(tile.type) ? profile : HeightProfileTable::NONE;
+                    }
+                }
+            }
+        }
+        buildTriggerRegions();
+        spdlog::trace("碰撞网格构建完成，尺寸: ({}, {})，HAZARD 区间: {}，LADDER 区间: {}",
+                      map_size_.x, map_size_.y, hazard_rows_.spans.size(), ladder_columns_.spans.size());
+    }
+
+    void CollisionGrid::clear()
+    {
+        tile_size_ = {0, 0};
+        map_size_ = {0, 0};
+        stride_ = 2 * PADDING;
+        cells_.assign(static_cast<size_t>(stride_) * 2 * PADDING, static_cast<std::uint8_t>(engine::component::TileType::EMPTY));
+        profiles_.assign(cells_.size(), HeightProfileTable::NONE);
+        triggers_.assign(cells_.size(), 0);
+        hazard_rows_.clear();
+        ladder_columns_.clear();
+    }
+
+    std::uint32_t CollisionGrid::getTriggerMask(glm::ivec2 start, glm::ivec2 end) const
+    {
+        // 钳制到网格范围内，填充区域没有触发器
+        start = glm::max(start, glm::ivec2(0));
+        end = glm::min(end, map_size_);
+        if (start.x >= end.x || start.y >= end.y)
+            return 0;
+
+        std::uint32_t mask = 0;
+        if (hazard_rows_.overlaps(start.y, end.y, start.x, end.x))
+            mask |= tileTypeBit(engine::component::TileType::HAZARD);
+        if (ladder_columns_.overlaps(start.x, end.x, start.y, end.y))
+            mask |= tileTypeBit(engine::component::TileType::LADDER);
+        return mask;
+    }
+
+    void CollisionGrid::buildTriggerRegions()
+    {
+        hazard_rows_.clear();
+        ladder_columns_.clear();
+        auto hasTrigger = [this](int x, int y, std::uint8_t bit)
+        { return (triggers_[static_cast<size_t>(y + PADDING) * stride_ + x + PADDING] & bit) != 0; };
+
+        // HAZARD: 每行内连续的瓦片合并为一个横向区间
+        hazard_rows_.offsets.reserve(static_cast<size_t>(map_size_.y) + 1);
+        for (int y = 0; y < map_size_.y; ++y)
+        {
+            hazard_rows_.offsets.push_back(hazard_rows_.spans.size());
+            for (int x = 0; x < map_size_.x; ++x)
+            {
+                if (!hasTrigger(x, y, TRIGGER_HAZARD))
+                    continue;
+                auto begin = x;
+                while (x + 1 < map_size_.x && hasTrigger(x + 1, y, TRIGGER_HAZARD))
+                    ++x;
+                hazard_rows_.spans.push_back({begin, x + 1});
+            }
+        }
+        hazard_rows_.offsets.push_back(hazard_rows_.spans.size());
+
+        // LADDER: 每列内连续的瓦片合并为一个纵向区间
+        ladder_columns_.offsets.reserve(static_cast<size_t>(map_size_.x) + 1);
+        for (int x = 0; x < map_size_.x; ++x)
+        {
+            ladder_columns_.offsets.push_back(ladder_columns_.spans.size());
+            for (int y = 0; y < map_size_.y; ++y)
+            {
+                if (!hasTrigger(x, y, TRIGGER_LADDER))
+                    continue;
+                auto begin = y;
+                while (y + 1 < map_size_.y && hasTrigger(x, y + 1, TRIGGER_LADDER))
+                    ++y;
+                ladder_columns_.spans.push_back({begin, y + 1});
+            }
+        }
+        ladder_columns_.offsets.push_back(ladder_columns_.spans.size());
+    }
+
+    void CollisionGrid::SpanIndex::clear()
+    {
+        offsets.clear();
+        spans.clear();
+    }
+
+    bool CollisionGrid::SpanIndex::overlaps(int line_begin, int line_end, int begin, int end) const
+    {
+        if (spans.empty())
+            return false;
+        for (auto line = line_begin; line < line_end; ++line)
+        {
+            auto first = spans.begin() + static_cast<std::ptrdiff_t>(offsets[line]);
+            auto last = spans.begin() + static_cast<std::ptrdiff_t>(offsets[line + 1]);
+            // 同一行的区间互不重叠且按 begin 升序，因此 end 也是升序的
+            auto it = std::partition_point(first, last, [begin](const TileSpan &span)
+                                           { return span.end <= begin; });
+            if (it != last && it->begin < end)
+                return true;
+        }
+        return false;
+    }
+
+    int CollisionGrid::getMergePriority(engine::component::TileType type)
+    {
+        switch (type)
+        {
+        case engine::component::TileType::SOLID:
+            return 5;
+        case engine::component::TileType::UNISOLID:
+            return 4;
+        case engine::component::TileType::SLOPE_0_1:
+        case engine::component::TileType::SLOPE_1_0:
+        case engine::component::TileType::SLOPE_0_2:
+        case engine::component::TileType::SLOPE_2_1:
+        case engine::component::TileType::SLOPE_1_2:
+        case engine::component::TileType::SLOPE_2_0:
+        case engine::component::TileType::SLOPE_CUSTOM:
+            return 3;
+        case engine::component::TileType::LADDER:
+            return 2;
+        case engine::component::TileType::HAZARD:
+            return 1;
+        default:
+            return 0; // EMPTY 和 NORMAL 对物理没有影响
+        }
+    }
+
+} // namespace engine::physics
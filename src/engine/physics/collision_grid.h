@@ -0,0 +1,124 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::component
+{
+    class TileLayerComponent;
+    enum class TileType;
+}
+
+namespace engine::physics
+{
+
+    /**
+     * @brief 合并所有碰撞瓦片层得到的紧凑碰撞网格，每个瓦片只占一个字节。
+     *
+     * 物理引擎中的瓦片查询都通过这里完成，避免访问包含 Sprite 的 TileInfo，也不需要逐层查询。
+     * 网格四周填充一圈空白瓦片，越界坐标会被钳制到这圈填充上，因此查询时无需越界检查和日志输出。
+     *
+     * 构建时还会预先计算触发器区域（HAZARD 按行合并为横向区间，LADDER 按列合并为纵向区间），
+     * 检测物体覆盖了哪些触发器瓦片时只需与这些区间求交，不必遍历每个格子。
+     * 触发器瓦片单独记录在每个格子的触发器位中，不参与类型合并，因此不会被其它图层的 SOLID 等瓦片覆盖。
+     */
+    class CollisionGrid final
+    {
+    public:
+        static constexpr int PADDING = 1; ///< @brief 四周填充的空白瓦片圈数
+
+        /// @brief 瓦片类型对应的掩码位
+        static constexpr std::uint32_t tileTypeBit(engine::component::TileType type)
+        {
+            return 1u << static_cast<std::uint32_t>(type);
+        }
+
+    private:
+        /// @brief 连续的同类瓦片区间 [begin, end)
+        struct TileSpan
+        {
+            int begin = 0;
+            int end = 0;
+        };
+
+        /**
+         * @brief 按行（或按列）分组存储的区间，同一行内的区间按 begin 升序排列。
+         * 第 line 行的区间为 spans[offsets[line], offsets[line + 1])。
+         */
+        struct SpanIndex
+        {
+            std::vector<size_t> offsets;
+            std::vector<TileSpan> spans;
+
+            void clear();
+            /// @brief 检查 [line_begin, line_end) 行中是否有区间与 [begin, end) 相交
+            bool overlaps(int line_begin, int line_end, int begin, int end) const;
+        };
+
+        glm::ivec2 tile_size_ = {0, 0};      ///< @brief 单个瓦片尺寸（像素）
+        glm::ivec2 map_size_ = {0, 0};       ///< @brief 网格尺寸（瓦片数，不含填充）
+        int stride_ = 2 * PADDING;           ///< @brief 每行的格子数（含填充）
+        std::vector<std::uint8_t> cells_;    ///< @brief 按行主序存储的瓦片类型（含填充）
+        std::vector<std::uint8_t> profiles_; ///< @brief 与 cells_ 对应的斜坡高度轮廓编号（非斜坡为0）
+        std::vector<std::uint8_t> triggers_; ///< @brief 与 cells_ 对应的触发器位（所有图层的 HAZARD/LADDER 瓦片）
+
+        SpanIndex hazard_rows_;              ///< @brief 每行的 HAZARD 横向区间（x 范围）
+        SpanIndex ladder_columns_;           ///< @brief 每列的 LADDER 纵向区间（y 范围）
+
+    public:
+        CollisionGrid() { clear(); }
+
+        /**
+         * @brief 根据瓦片层重新构建网格。
+         *
+         * 网格尺寸取所有图层的最大值，瓦片尺寸取第一个图层的值（尺寸不同的图层会被忽略）。
+         * 同一位置有多个图层的瓦片时，按 SOLID > UNISOLID > 斜坡 > LADDER > HAZARD > NORMAL 的优先级合并。
+         * 斜坡瓦片同时记录其高度轮廓编号（瓦片没有指定时使用类型的默认轮廓）。
+         */
+        void rebuild(const std::vector<engine::component::TileLayerComponent *> &layers);
+        void clear(); ///< @brief 清空网格（查询结果均为 EMPTY）
+
+        bool empty() const { return map_size_.x <= 0 || map_size_.y <= 0; } ///< @brief 网格是否为空
+        glm::ivec2 getTileSize() const { return tile_size_; }               ///< @brief 获取单个瓦片尺寸
+        glm::ivec2 getMapSize() const { return map_size_; }                 ///< @brief 获取网格尺寸（瓦片数）
+
+        /**
+         * @brief 根据瓦片坐标获取合并后的瓦片类型。
+         * @param pos 瓦片坐标，可以越界（越界时返回 EMPTY）
+         */
+        engine::component::TileType getTileTypeAt(glm::ivec2 pos) const
+        {
+            auto x = std::clamp(pos.x, -PADDING, map_size_.x - 1 + PADDING) + PADDING;
+            auto y = std::clamp(pos.y, -PADDING, map_size_.y - 1 + PADDING) + PADDING;
+            return static_cast<engine::component::TileType>(cells_[static_cast<size_t>(y) * stride_ + x]);
+        }
+
+        /**
+         * @brief 根据瓦片坐标获取斜坡高度轮廓编号（见 HeightProfileTable）。
+         * @param pos 瓦片坐标，可以越界（越界时返回0）
+         */
+        std::uint8_t getHeightProfileAt(glm::ivec2 pos) const
+        {
+            auto x = std::clamp(pos.x, -PADDING, map_size_.x - 1 + PADDING) + PADDING;
+            auto y = std::clamp(pos.y, -PADDING, map_size_.y - 1 + PADDING) + PADDING;
+            return profiles_[static_cast<size_t>(y) * stride_ + x];
+        }
+
+        /**
+         * @brief 检测瓦片矩形范围内包含哪些触发器类型的瓦片（目前为 HAZARD 和 LADDER），不分配内存。
+         * @param start 范围起点瓦片坐标（包含）
+         * @param end 范围终点瓦片坐标（不包含）
+         * @return 触发器掩码，每种瓦片类型对应 tileTypeBit(type) 一位
+         */
+        std::uint32_t getTriggerMask(glm::ivec2 start, glm::ivec2 end) const;
+
+    private:
+        static constexpr std::uint8_t TRIGGER_HAZARD = 1 << 0; ///< @brief 格子中有 HAZARD 瓦片
+        static constexpr std::uint8_t TRIGGER_LADDER = 1 << 1; ///< @brief 格子中有 LADDER 瓦片
+
+        static int getMergePriority(engine::component::TileType type); ///< @brief 合并图层时瓦片类型的优先级（越大越优先）
+        void buildTriggerRegions();                                    ///< @brief 根据各格子的触发器位计算触发器区间
+    };
+
+} // namespace engine::physics
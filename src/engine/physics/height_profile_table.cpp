@@ -0,0 +1,107 @@
+#include "height_profile_table.h"
+#include "../component/tilelayer_component.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::physics
+{
+
+    HeightProfileTable::HeightProfileTable()
+    {
+        // 内置斜坡的编号与 getDefaultProfile 一致，按此顺序注册
+        addProfile({0.0f, 1.0f});  // SLOPE_0_1: 左0  右1
+        addProfile({1.0f, 0.0f});  // SLOPE_1_0: 左1  右0
+        addProfile({0.0f, 0.5f});  // SLOPE_0_2: 左0  右1/2
+        addProfile({0.5f, 1.0f});  // SLOPE_2_1: 左1/2右1
+        addProfile({1.0f, 0.5f});  // SLOPE_1_2: 左1  右1/2
+        addProfile({0.5f, 0.0f});  // SLOPE_2_0: 左1/2右0
+    }
+
+    std::uint8_t HeightProfileTable::addProfile(std::vector<float> keypoints)
+    {
+        if (keypoints.empty())
+        {
+            spdlog::warn("高度轮廓至少需要一个关键点。");
+            return NONE;
+        }
+        for (auto &keypoint : keypoints)
+        {
+            keypoint = std::clamp(keypoint, 0.0f, 1.0f);
+        }
+        if (auto it = std::find(keypoints_.begin(), keypoints_.end(), keypoints); it != keypoints_.end())
+        {
+            return static_cast<std::uint8_t>(it - keypoints_.begin() + 1);
+        }
+        if (keypoints_.size() >= MAX_PROFILES)
+        {
+            spdlog::warn("高度轮廓数量已达上限 ({})，忽略新的轮廓。", MAX_PROFILES);
+            return NONE;
+        }
+        keypoints_.push_back(std::move(keypoints));
+        if (stride_ > 0)
+        {
+            bakeProfile(keypoints_.back());
+        }
+        return static_cast<std::uint8_t>(keypoints_.size());
+    }
+
+    std::uint8_t HeightProfileTable::getDefaultProfile(engine::component::TileType type)
+    {
+        switch (type)
+        {
+        case engine::component::TileType::SLOPE_0_1:
+            return 1;
+        case engine::component::TileType::SLOPE_1_0:
+            return 2;
+        case engine::component::TileType::SLOPE_0_2:
+            return 3;
+        case engine::component::TileType::SLOPE_2_1:
+            return 4;
+        case engine::component::TileType::SLOPE_1_2:
+            return 5;
+        case engine::component::TileType::SLOPE_2_0:
+            return 6;
+        default:
+            return NONE; // SLOPE_CUSTOM 没有默认轮廓，由瓦片集指定
+        }
+    }
+
+    bool HeightProfileTable::isSlope(engine::component::TileType type)
+    {
+        return type == engine::component::TileType::SLOPE_CUSTOM || getDefaultProfile(type) != NONE;
+    }
+
+    void HeightProfileTable::bake(glm::ivec2 tile_size)
+    {
+        if (tile_size == tile_size_ || tile_size.x <= 0 || tile_size.y <= 0)
+        {
+            return;
+        }
+        tile_size_ = tile_size;
+        stride_ = tile_size.x + 1;
+        heights_.clear();
+        heights_.reserve(keypoints_.size() * stride_);
+        for (const auto &keypoints : keypoints_)
+        {
+            bakeProfile(keypoints);
+        }
+        spdlog::trace("高度轮廓表烘焙完成，轮廓数: {}，瓦片尺寸: ({}, {})", keypoints_.size(), tile_size.x, tile_size.y);
+    }
+
+    void HeightProfileTable::bakeProfile(const std::vector<float> &keypoints)
+    {
+        // 关键点在 [0, 瓦片宽度] 上均匀分布，相邻关键点之间线性插值
+        auto segments = static_cast<float>(keypoints.size() - 1);
+        for (int column = 0; column < stride_; ++column)
+        {
+            auto height = keypoints.front();
+            if (keypoints.size() > 1)
+            {
+                auto position = static_cast<float>(column) / static_cast<float>(tile_size_.x) * segments;
+                auto index = std::min(static_cast<size_t>(position), keypoints.size() - 2);
+                height = keypoints[index] + (keypoints[index + 1] - keypoints[index]) * (position - static_cast<float>(index));
+            }
+            heights_.push_back(height * static_cast<float>(tile_size_.y));
+        }
+    }
+
+} // namespace engine::physics
@@ -0,0 +1,74 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::component
+{
+    enum class TileType;
+}
+
+namespace engine::physics
+{
+
+    /**
+     * @brief 斜坡瓦片的高度轮廓表。
+     *
+     * 每个轮廓由若干在瓦片宽度上均匀分布的关键点描述（高度为瓦片高度的比例，从瓦片下侧起算），
+     * 内置斜坡类型各对应一个轮廓，瓦片集也可以通过属性添加任意的斜坡或曲面轮廓。
+     * 瓦片尺寸确定后烘焙为每个像素列一个高度值的表，查询时只需一次查表（相邻两列线性插值）。
+     */
+    class HeightProfileTable final
+    {
+    public:
+        static constexpr std::uint8_t NONE = 0;      ///< @brief 无轮廓（高度恒为0）
+        static constexpr size_t MAX_PROFILES = 255; ///< @brief 轮廓编号占一个字节，0 保留给 NONE
+
+    private:
+        std::vector<std::vector<float>> keypoints_; ///< @brief 每个轮廓的关键点（下标为编号 - 1）
+        glm::ivec2 tile_size_ = {0, 0};             ///< @brief 烘焙时使用的瓦片尺寸
+        int stride_ = 0;                            ///< @brief 每个轮廓的像素列数（瓦片宽度 + 1，包含右边缘）
+        std::vector<float> heights_;                ///< @brief 烘焙后的高度表（像素），按轮廓依次排列
+
+    public:
+        HeightProfileTable(); ///< @brief 构造函数，注册内置斜坡类型的轮廓
+
+        /**
+         * @brief 添加一个高度轮廓（与已有轮廓相同时直接返回已有编号）。
+         * @param keypoints 关键点高度（瓦片高度的比例，会被钳制到 [0, 1]），至少一个。
+         * @return 轮廓编号；关键点为空或轮廓数量已满时返回 NONE。
+         */
+        std::uint8_t addProfile(std::vector<float> keypoints);
+
+        /// @brief 内置斜坡类型对应的轮廓编号（非斜坡类型返回 NONE）
+        static std::uint8_t getDefaultProfile(engine::component::TileType type);
+        /// @brief 瓦片类型是否为斜坡（内置斜坡或 SLOPE_CUSTOM）
+        static bool isSlope(engine::component::TileType type);
+
+        /// @brief 按瓦片尺寸烘焙所有轮廓的高度表（尺寸不变时不做任何事）
+        void bake(glm::ivec2 tile_size);
+
+        size_t getProfileCount() const { return keypoints_.size(); } ///< @brief 获取轮廓数量
+
+        /**
+         * @brief 查询轮廓在指定宽度处的高度。
+         * @param profile 轮廓编号。
+         * @param width 从瓦片左侧起算的宽度（会被钳制到瓦片范围内）。
+         * @return 从瓦片下侧起算的高度（像素），NONE 或尚未烘焙时为0。
+         */
+        float getHeight(std::uint8_t profile, float width) const
+        {
+            if (profile == NONE || stride_ <= 0 || profile > keypoints_.size())
+                return 0.0f;
+            auto x = std::clamp(width, 0.0f, static_cast<float>(stride_ - 1));
+            auto column = std::min(static_cast<int>(x), stride_ - 2);
+            const auto *row = heights_.data() + static_cast<size_t>(profile - 1) * stride_;
+            return row[column] + (row[column + 1] - row[column]) * (x - static_cast<float>(column));
+        }
+
+    private:
+        void bakeProfile(const std::vector<float> &keypoints); ///< @brief 烘焙单个轮廓并追加到高度表末尾
+    };
+
+} // namespace engine::physics
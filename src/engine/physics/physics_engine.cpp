@@ -5,31 +5,182 @@
 #include "../component/collider_component.h"
 #include "../component/tilelayer_component.h"
 #include "../object/game_object.h"
-#include <set>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <bit>
+#include <chrono>
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
 
 namespace engine::physics
 {
 
+    namespace
+    {
+        /**
+         * @brief 射线与 AABB 的 slab 检测。
+         * 边界接触不算相交（方向分量为0的轴要求起点严格位于区间内），避免沿地面移动时被脚下的瓦片挡住。
+         * @param t 输出：进入 AABB 时沿方向移动的距离（起点在内部时为0）。
+         * @param normal 输出：进入面的法线（起点在内部时为零向量）。
+         */
+        bool intersectRayAABB(glm::vec2 origin, glm::vec2 direction, glm::vec2 box_min, glm::vec2 box_max, float max_distance,
+                              float &t, glm::vec2 &normal)
+        {
+            float t_min = 0.0f;
+            float t_max = max_distance;
+            normal = {0.0f, 0.0f};
+            for (int axis = 0; axis < 2; ++axis)
+            {
+                if (std::abs(direction[axis]) < 1e-6f)
+                {
+                    if (origin[axis] <= box_min[axis] || origin[axis] >= box_max[axis])
+                        return false;
+                    continue;
+                }
+                auto inv = 1.0f / direction[axis];
+                auto t1 = (box_min[axis] - origin[axis]) * inv;
+                auto t2 = (box_max[axis] - origin[axis]) * inv;
+                auto sign = -1.0f; // 从最小面进入时，法线指向负方向
+                if (t1 > t2)
+                {
+                    std::swap(t1, t2);
+                    sign = 1.0f;
+                }
+                if (t1 > t_min)
+                {
+                    t_min = t1;
+                    normal = {0.0f, 0.0f};
+                    normal[axis] = sign;
+                }
+                t_max = std::min(t_max, t2);
+                if (t_min >= t_max)
+                    return false;
+            }
+            t = t_min;
+            return true;
+        }
+
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief 两个时间点之间的微秒数
+        float toMicroseconds(Clock::duration duration)
+        {
+            return std::chrono::duration<float, std::micro>(duration).count();
+        }
+
+        constexpr float FIXED_POINT_SCALE = 256.0f; // 定点数模式的精度：1/256 像素 (相当于 24.8 定点数)
+
+        /// @brief 把向量舍入到定点数网格
+        glm::vec2 toFixedPoint(glm::vec2 value)
+        {
+            return glm::round(value * FIXED_POINT_SCALE) / FIXED_POINT_SCALE;
+        }
+
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+        /// @brief 把一个整数按字节混入 FNV-1a 哈希
+        template <typename T>
+        void hashCombine(std::uint64_t &hash, T value)
+        {
+            auto bits = static_cast<std::uint64_t>(value);
+            for (size_t i = 0; i < sizeof(T); ++i)
+            {
+                hash ^= (bits >> (i * 8)) & 0xFFu;
+                hash *= FNV_PRIME;
+            }
+        }
+
+        /// @brief 按位混入浮点向量（-0 与 +0 视为不同，与实际状态保持一致）
+        void hashCombine(std::uint64_t &hash, glm::vec2 value)
+        {
+            hashCombine(hash, std::bit_cast<std::uint32_t>(value.x));
+            hashCombine(hash, std::bit_cast<std::uint32_t>(value.y));
+        }
+    } // namespace
+
     void PhysicsEngine::registerComponent(engine::component::PhysicsComponent *component)
     {
-        components_.push_back(component);
+        component->body_index_ = bodies_.add(component, component->mass_, component->use_gravity_);
+        bodies_.types[component->body_index_] = component->body_type_;
+        // 注册前通过组件设置的启用状态、速度和力
+        bodies_.enabled[component->body_index_] = component->enabled_ ? 1 : 0;
+        bodies_.velocities[component->body_index_] = component->velocity_;
+        bodies_.forces[component->body_index_] = component->force_;
+        refreshComponentCache(component);
+        broadphase_valid_ = false; // 新物体不在空间哈希中，下一次检测前查询退回遍历
         spdlog::trace("物理组件注册完成。");
     }
 
     void PhysicsEngine::unregisterComponent(engine::component::PhysicsComponent *component)
     {
-        // 使用 remove-erase 方法安全地移除指针
-        auto it = std::remove(components_.begin(), components_.end(), component);
-        components_.erase(it, components_.end());
+        // 优先使用组件保存的下标，失效时再线性查找
+        auto index = component->body_index_;
+        if (index >= bodies_.size() || bodies_.components[index] != component)
+        {
+            auto it = std::find(bodies_.components.begin(), bodies_.components.end(), component);
+            if (it == bodies_.components.end())
+            {
+                return;
+            }
+            index = static_cast<size_t>(it - bodies_.components.begin());
+        }
+        // 按顺序移除，并更新其后物体的下标（空间哈希中的下标随之失效）
+        bodies_.erase(index);
+        broadphase_valid_ = false;
+        for (size_t i = index; i < bodies_.size(); ++i)
+        {
+            bodies_.components[i]->body_index_ = i;
+        }
+        // 对象即将销毁：直接移除相关接触（不产生离开事件），其余接触的下标同步前移（排序不变）
+        std::erase_if(contacts_, [index](const Contact &contact)
+                      { return contact.first_index == index || contact.second_index == index; });
+        for (auto &contact : contacts_)
+        {
+            if (contact.first_index > index)
+                --contact.first_index;
+            if (contact.second_index > index)
+                --contact.second_index;
+        }
+        // 本步已产生的事件中也不能再保留该对象的指针
+        if (auto *owner = component->getOwner(); owner)
+        {
+            auto involves_owner = [owner](const CollisionPair &pair)
+            { return pair.first == owner || pair.second == owner; };
+            std::erase_if(collision_pairs_, involves_owner);
+            std::erase_if(contact_enter_events_, involves_owner);
+            std::erase_if(contact_stay_events_, involves_owner);
+            std::erase_if(contact_exit_events_, involves_owner);
+        }
+        component->body_index_ = engine::component::PhysicsComponent::INVALID_INDEX;
         spdlog::trace("物理组件注销完成。");
     }
 
+    void PhysicsEngine::refreshComponentCache(engine::component::PhysicsComponent *component)
+    {
+        auto index = component->body_index_;
+        if (index >= bodies_.size())
+        {
+            return;
+        }
+        auto *obj = component->getOwner();
+        bodies_.transforms[index] = component->getTransform();
+        bodies_.colliders[index] = obj ? obj->getComponent<engine::component::ColliderComponent>() : nullptr;
+    }
+
     void PhysicsEngine::registerCollisionLayer(engine::component::TileLayerComponent *layer)
     {
         layer->setPhysicsEngine(this); // 设置物理引擎指针
         collision_tile_layers_.push_back(layer);
+        collision_grid_.rebuild(collision_tile_layers_);      // 重新合并所有碰撞图层
+        static_geometry_.rebuild(collision_grid_);            // 合并静态碰撞矩形
+        height_profiles_.bake(collision_grid_.getTileSize()); // 按瓦片尺寸烘焙斜坡高度表
+        // 粗检测的网格单元取首个碰撞图层瓦片尺寸的 4 倍，能覆盖大部分角色和道具
+        if (collision_tile_layers_.size() == 1)
+        {
+            broadphase_.setCellSize(layer->getTileSize().x * 4.0f);
+        }
         spdlog::trace("碰撞瓦片图层注册完成。");
     }
 
@@ -37,127 +188,509 @@ namespace engine::physics
     {
         auto it = std::remove(collision_tile_layers_.begin(), collision_tile_layers_.end(), layer);
         collision_tile_layers_.erase(it, collision_tile_layers_.end());
+        collision_grid_.rebuild(collision_tile_layers_);
+        static_geometry_.rebuild(collision_grid_);
         spdlog::trace("碰撞瓦片图层注销完成。");
     }
 
+    void PhysicsEngine::refreshCollisionLayers()
+    {
+        collision_grid_.rebuild(collision_tile_layers_);
+        static_geometry_.rebuild(collision_grid_);
+    }
+
     void PhysicsEngine::update(float delta_time)
     {
-        // 每帧开始时先清空碰撞对列表和瓦片触发事件列表
+        // 确定性模式下每步都使用固定步长，结果与帧时间无关
+        if (deterministic_)
+        {
+            delta_time = fixed_delta_time_;
+        }
+        // 每帧开始时先清空碰撞对列表、瓦片触发事件列表和统计
         collision_pairs_.clear();
         tile_trigger_events_.clear();
+        stats_ = {};
+        // 未启用统计时不读取时钟，所有耗时都为0
+        auto now = [this]
+        { return stats_enabled_ ? Clock::now() : Clock::time_point{}; };
+        auto step_start = now();
+
+        // 从组件读取位置和碰撞盒，之后的积分与瓦片碰撞只访问连续数组
+        gatherBodies();
 
-        // 遍历所有注册的物理组件
-        for (auto *pc : components_)
+        // 每个物体的积分和瓦片碰撞只读取共享数据（碰撞网格、重力等），只写入自身数据，
+        // 因此物体数量较多时可以分段并行处理，结果与串行完全一致
+        if (worker_pool_ && bodies_.size() >= parallel_threshold_)
         {
-            if (!pc || !pc->isEnabled())
-            { // 检查组件是否有效和启用
-                continue;
+            worker_pool_->parallelFor(bodies_.size(), [this, delta_time](size_t begin, size_t end)
+                                      { stepBodies(begin, end, delta_time); });
+        }
+        else
+        {
+            stepBodies(0, bodies_.size(), delta_time);
+        }
+        // 写回 Transform，对象间碰撞需要用到最新位置
+        scatterBodies();
+
+        // 处理对象间碰撞，并根据本步的碰撞对更新接触缓存 (SOLID 推开的耗时在 handleObjectPair 中单独统计)
+        auto pairs_start = now();
+        checkObjectCollisions();
+        stats_.object_pairs_us = toMicroseconds(now() - pairs_start) - stats_.solid_resolve_us;
+        updateContacts();
+
+        // 检测瓦片触发事件 (检测前已经处理完位移)
+        auto triggers_start = now();
+        checkTileTriggers();
+        stats_.tile_triggers_us = toMicroseconds(now() - triggers_start);
+        stats_.trigger_events = static_cast<std::uint32_t>(tile_trigger_events_.size());
+
+        // 根据本帧结束时的速度更新休眠状态
+        updateSleepStates(delta_time);
+
+        ++step_count_;
+        if (deterministic_)
+        {
+            step_checksum_ = computeChecksum();
+            spdlog::trace("物理步 {} 校验和: {:016x}", step_count_, step_checksum_);
+        }
+
+        stats_.total_us = toMicroseconds(now() - step_start);
+        if (stats_history_size_ > 0)
+        {
+            // 环形缓冲区：填满之前追加，之后覆盖最旧的记录
+            if (stats_history_.size() < stats_history_size_)
+                stats_history_.push_back(stats_);
+            else
+                stats_history_[stats_history_next_] = stats_;
+            stats_history_next_ = (stats_history_next_ + 1) % stats_history_size_;
+        }
+    }
+
+    void PhysicsEngine::setStatsHistorySize(size_t size)
+    {
+        stats_history_size_ = size;
+        stats_history_.clear();
+        stats_history_.reserve(size);
+        stats_history_next_ = 0;
+    }
+
+    size_t PhysicsEngine::getStatsHistory(std::vector<PhysicsStats> &out) const
+    {
+        out.clear();
+        if (stats_history_.size() < stats_history_size_)
+        {
+            out.assign(stats_history_.begin(), stats_history_.end());
+        }
+        else
+        {
+            // 缓冲区已满时，下一条写入位置就是最旧的记录
+            out.assign(stats_history_.begin() + static_cast<std::ptrdiff_t>(stats_history_next_), stats_history_.end());
+            out.insert(out.end(), stats_history_.begin(), stats_history_.begin() + static_cast<std::ptrdiff_t>(stats_history_next_));
+        }
+        return out.size();
+    }
+
+    void PhysicsEngine::gatherBodies()
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            auto *tc = bodies_.transforms[i];
+            if (tc)
+            {
+                // 游戏逻辑直接修改了位置（如传送），需要唤醒物体重新参与模拟
+                if (bodies_.sleeping[i] && tc->getPosition() != bodies_.positions[i])
+                {
+                    bodies_.wake(i);
+                }
+                bodies_.positions[i] = tc->getPosition();
+            }
+            // 同步碰撞器状态与碰撞盒（碰撞器的激活状态、缩放等可能在游戏逻辑中被修改）
+            std::uint8_t collider_flags = 0;
+            auto *cc = bodies_.colliders[i];
+            if (tc && cc && cc->getCollider() && cc->getTransform())
+            {
+                collider_flags |= collider_flag::PRESENT;
+                if (cc->isActive())
+                    collider_flags |= collider_flag::ACTIVE;
+                if (cc->isTrigger())
+                    collider_flags |= collider_flag::TRIGGER;
+                bodies_.aabb_offsets[i] = cc->getOffset();
+                bodies_.aabb_sizes[i] = cc->getCollider()->getAABBSize() * cc->getTransform()->getScale();
             }
+            bodies_.collider_flags[i] = collider_flags;
+            if (bodies_.enabled[i] && bodies_.isMoving(i))
+            {
+                ++stats_.active_bodies;
+            }
+        }
+    }
 
-            pc->resetCollisionFlags(); // 重置碰撞标志
+    void PhysicsEngine::stepBodies(size_t begin, size_t end, float delta_time)
+    {
+        // 耗时先在本段内累计，结束时再合并到 stats_（并行时每段只加锁一次）
+        auto now = [this]
+        { return stats_enabled_ ? Clock::now() : Clock::time_point{}; };
+        Clock::duration integrate_time{};
+        Clock::duration tile_time{};
+        Clock::duration bounds_time{};
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            // 静态和休眠物体跳过积分和位移（休眠物体保留上次的碰撞标志，例如“站在地面上”）
+            if (!bodies_.enabled[i] || !bodies_.isMoving(i))
+            {
+                continue;
+            }
+            bodies_.flags[i] = 0; // 重置碰撞标志
+            auto integrate_start = now();
+            if (bodies_.types[i] == BodyType::KINEMATIC)
+            {
+                // 运动学物体只按设定的速度移动，忽略力和重力，也不受瓦片和世界边界约束
+                bodies_.forces[i] = {0.0f, 0.0f};
+                bodies_.positions[i] += bodies_.velocities[i] * delta_time;
+                if (fixed_point_)
+                {
+                    bodies_.positions[i] = toFixedPoint(bodies_.positions[i]);
+                }
+                integrate_time += now() - integrate_start;
+                continue;
+            }
 
             // 应用重力 (如果组件受重力影响)：F = g * m
-            if (pc->isUseGravity())
+            if (bodies_.use_gravity[i])
             {
-                pc->addForce(gravity_ * pc->getMass());
+                bodies_.forces[i] += gravity_ * bodies_.masses[i];
             }
             /* 还可以添加其它力影响，比如风力、摩擦力等，目前不考虑 */
 
             // 更新速度： v += a * dt，其中 a = F / m
-            pc->velocity_ += (pc->getForce() / pc->getMass()) * delta_time;
-            pc->clearForce(); // 清除当前帧的力
+            bodies_.velocities[i] += (bodies_.forces[i] / bodies_.masses[i]) * delta_time;
+            bodies_.forces[i] = {0.0f, 0.0f}; // 清除当前帧的力
 
-            // // 更新位置
-            // auto *tc = pc->getTransform();
-            // if (tc)
-            // {
-            //     tc->translate(pc->velocity_ * delta_time);
-            // }
+            // 处理瓦片层碰撞（速度和位置的更新移入此函数），高速物体会被拆分为多个子步
+            auto tile_start = now();
+            integrate_time += tile_start - integrate_start;
+            resolveTileCollisionsSubstepped(i, delta_time);
 
-            // pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
+            // 应用世界边界
+            auto bounds_start = now();
+            tile_time += bounds_start - tile_start;
+            applyWorldBounds(i);
+            bounds_time += now() - bounds_start;
 
-            // 处理瓦片层碰撞（速度和位置的更新移入此函数）
-            resolveTileCollisions(pc, delta_time);
+            // 定点数模式：把位置和速度舍入到定点数网格，避免浮点误差逐步累积
+            if (fixed_point_)
+            {
+                bodies_.positions[i] = toFixedPoint(bodies_.positions[i]);
+                bodies_.velocities[i] = toFixedPoint(bodies_.velocities[i]);
+            }
+        }
 
-            // 应用世界边界
-            applyWorldBounds(pc);
+        if (stats_enabled_)
+        {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            stats_.integrate_us += toMicroseconds(integrate_time);
+            stats_.tile_resolve_us += toMicroseconds(tile_time);
+            stats_.world_bounds_us += toMicroseconds(bounds_time);
         }
-        // 处理对象间碰撞
-        checkObjectCollisions();
+    }
 
-        // 检测瓦片触发事件 (检测前已经处理完位移)
-        checkTileTriggers();
+    std::uint64_t PhysicsEngine::computeChecksum() const
+    {
+        // 按物体下标顺序混入状态，物体注册顺序相同的两次运行才会得到相同结果
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        hashCombine(hash, step_count_);
+        hashCombine(hash, bodies_.size());
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            hashCombine(hash, bodies_.positions[i]);
+            hashCombine(hash, bodies_.velocities[i]);
+            hashCombine(hash, bodies_.flags[i]);
+            hashCombine(hash, bodies_.enabled[i]);
+            hashCombine(hash, bodies_.sleeping[i]);
+        }
+        // 接触按下标对排序，顺序本身也是确定的
+        hashCombine(hash, contacts_.size());
+        for (const auto &contact : contacts_)
+        {
+            hashCombine(hash, contact.first_index);
+            hashCombine(hash, contact.second_index);
+        }
+        hashCombine(hash, tile_trigger_events_.size());
+        return hash;
+    }
+
+    void PhysicsEngine::setWorkerThreadCount(size_t count)
+    {
+        if (count == getWorkerThreadCount())
+        {
+            return;
+        }
+        worker_pool_ = count > 0 ? std::make_unique<engine::core::WorkerPool>(count) : nullptr;
+    }
+
+    size_t PhysicsEngine::getWorkerThreadCount() const
+    {
+        return worker_pool_ ? worker_pool_->getThreadCount() : 0;
+    }
+
+    void PhysicsEngine::scatterBodies()
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            if (bodies_.enabled[i] && bodies_.isMoving(i) && bodies_.transforms[i])
+            {
+                bodies_.transforms[i]->setPosition(bodies_.positions[i]);
+            }
+        }
     }
 
     void PhysicsEngine::checkObjectCollisions()
+    {
+        collectActiveColliders();
+        if (broadphase_enabled_)
+        {
+            checkObjectCollisionsBroadphase();
+            broadphase_valid_ = true;
+        }
+        else
+        {
+            checkObjectCollisionsBruteForce();
+            broadphase_valid_ = false;
+        }
+    }
+
+    void PhysicsEngine::collectActiveColliders()
+    {
+        active_colliders_.assign(bodies_.size(), nullptr);
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            constexpr std::uint8_t required = collider_flag::PRESENT | collider_flag::ACTIVE;
+            if (bodies_.enabled[i] && (bodies_.collider_flags[i] & required) == required)
+            {
+                active_colliders_[i] = bodies_.colliders[i];
+            }
+        }
+    }
+
+    void PhysicsEngine::checkObjectCollisionsBruteForce()
     {
         // 两层循环遍历所有包含物理组件的 GameObject
-        for (size_t i = 0; i < components_.size(); ++i)
+        for (size_t i = 0; i < bodies_.size(); ++i)
         {
-            auto *pc_a = components_[i];
-            if (!pc_a || !pc_a->isEnabled())
+            if (!active_colliders_[i])
             {
                 continue;
             }
-            auto *obj_a = pc_a->getOwner();
-            if (!obj_a)
+            for (size_t j = i + 1; j < bodies_.size(); ++j)
             {
-                continue;
+                if (!active_colliders_[j])
+                    continue;
+                handleObjectPair(i, j);
             }
-            auto *cc_a = obj_a->getComponent<engine::component::ColliderComponent>();
-            if (!cc_a || !cc_a->isActive())
+        }
+    }
+
+    void PhysicsEngine::checkObjectCollisionsBroadphase()
+    {
+        // 重建空间哈希（clear 会保留网格单元的内存）
+        broadphase_.clear();
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            if (active_colliders_[i])
+            {
+                broadphase_.insert(i, bodies_.getWorldAABB(i));
+            }
+        }
+
+        // 与两两遍历保持相同的检测顺序：按 i 升序，每个 i 只检测 j > i 的候选对象，且 j 按升序处理。
+        // 这样 SOLID 物体推开对象后的结果、以及 collision_pairs_ 的内容和顺序都与两两遍历完全一致。
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            if (!active_colliders_[i])
             {
                 continue;
             }
-            for (size_t j = i + 1; j < components_.size(); ++j)
+            broadphase_.query(bodies_.getWorldAABB(i), broadphase_candidates_);
+            auto it = std::upper_bound(broadphase_candidates_.begin(), broadphase_candidates_.end(), i);
+            while (it != broadphase_candidates_.end())
             {
-                auto *pc_b = components_[j];
-                if (!pc_b || !pc_b->isEnabled())
-                    continue;
-                auto *obj_b = pc_b->getOwner();
-                if (!obj_b)
-                    continue;
-                auto *cc_b = obj_b->getComponent<engine::component::ColliderComponent>();
-                if (!cc_b || !cc_b->isActive())
+                auto j = *it;
+                auto moved = handleObjectPair(i, j);
+                if (!moved)
+                {
+                    ++it;
                     continue;
-                /* --- 通过保护性测试后，正式执行逻辑 --- */
-
-                if (collision::checkCollision(*cc_a, *cc_b))
+                }
+                // 有对象被推开，同步更新它在空间哈希中的位置
+                broadphase_.update(*moved, bodies_.getWorldAABB(*moved));
+                if (*moved == i)
                 {
-                    // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
-                    if (obj_a->getTag() != "solid" && obj_b->getTag() == "solid")
-                    {
-                        resolveSolidObjectCollisions(obj_a, obj_b);
-                    }
-                    else if (obj_a->getTag() == "solid" && obj_b->getTag() != "solid")
-                    {
-                        resolveSolidObjectCollisions(obj_b, obj_a);
-                    }
-                    else
-                    {
-                        // 记录碰撞对
-                        collision_pairs_.emplace_back(obj_a, obj_b);
-                    }
+                    // i 自身移动后，剩余的候选对象需要用新位置重新查询（只保留 j 之后的对象）
+                    broadphase_.query(bodies_.getWorldAABB(i), broadphase_candidates_);
+                    it = std::upper_bound(broadphase_candidates_.begin(), broadphase_candidates_.end(), j);
                 }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+    }
+
+    void PhysicsEngine::updateContacts()
+    {
+        contact_enter_events_.clear();
+        contact_stay_events_.clear();
+        contact_exit_events_.clear();
+
+        // 碰撞对本就按 (i, j) 升序产生，这里排序只是保证合并的前提条件
+        auto by_index = [](const Contact &a, const Contact &b)
+        { return a.first_index != b.first_index ? a.first_index < b.first_index : a.second_index < b.second_index; };
+        std::sort(current_contacts_.begin(), current_contacts_.end(), by_index);
+
+        // 有序合并：只在本步出现的是进入，两边都有的是保持，只在上一步出现的是离开
+        size_t prev = 0;
+        size_t curr = 0;
+        while (prev < contacts_.size() || curr < current_contacts_.size())
+        {
+            if (curr == current_contacts_.size() || (prev < contacts_.size() && by_index(contacts_[prev], current_contacts_[curr])))
+            {
+                contact_exit_events_.push_back(contacts_[prev++].pair);
+            }
+            else if (prev == contacts_.size() || by_index(current_contacts_[curr], contacts_[prev]))
+            {
+                // 只在接触开始时唤醒动态物体；持续重叠（例如停在触发区域内）不妨碍休眠
+                const auto &contact = current_contacts_[curr++];
+                if (bodies_.types[contact.first_index] == BodyType::DYNAMIC)
+                    bodies_.wake(contact.first_index);
+                if (bodies_.types[contact.second_index] == BodyType::DYNAMIC)
+                    bodies_.wake(contact.second_index);
+                contact_enter_events_.push_back(contact.pair);
+            }
+            else
+            {
+                contact_stay_events_.push_back(current_contacts_[curr].pair);
+                ++prev;
+                ++curr;
             }
         }
+
+        // 本步的接触成为下一步的“上一步”，交换后两个容器的容量都得以保留
+        contacts_.swap(current_contacts_);
+        current_contacts_.clear();
+    }
+
+    std::optional<size_t> PhysicsEngine::handleObjectPair(size_t i, size_t j)
+    {
+        // 双方都是静态物体时，它们之间的关系不会改变，无需检测。
+        // 休眠物体仍需检测：新生成或重新启用的静态物体与其重叠时要产生进入事件并唤醒它
+        if (bodies_.types[i] == BodyType::STATIC && bodies_.types[j] == BodyType::STATIC)
+        {
+            return std::nullopt;
+        }
+        ++stats_.candidate_pairs;
+        auto *cc_a = active_colliders_[i];
+        auto *cc_b = active_colliders_[j];
+        // 类别与掩码不匹配的对象永远不会交互，无需进行精确检测
+        if (!cc_a->canCollideWith(*cc_b))
+        {
+            return std::nullopt;
+        }
+        ++stats_.narrowphase_tests;
+        if (!collision::checkCollision(*cc_a, *cc_b))
+        {
+            return std::nullopt;
+        }
+        auto category_a = cc_a->getCategory();
+        auto category_b = cc_b->getCategory();
+        bool solid_a = (category_a & category::SOLID) != 0;
+        bool solid_b = (category_b & category::SOLID) != 0;
+        // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
+        // 只有动态物体会被SOLID物体推开；静态/运动学物体与SOLID物体重叠时不做任何处理
+        if (!solid_a && solid_b)
+        {
+            if (bodies_.types[i] != BodyType::DYNAMIC)
+                return std::nullopt;
+            bodies_.wake(i); // 被推开的物体必须唤醒，否则新位置不会写回
+            resolveSolidObjectCollisionsTimed(i, j);
+            return i;
+        }
+        else if (solid_a && !solid_b)
+        {
+            if (bodies_.types[j] != BodyType::DYNAMIC)
+                return std::nullopt;
+            bodies_.wake(j);
+            resolveSolidObjectCollisionsTimed(j, i);
+            return j;
+        }
+        // 记录碰撞对
+        collision_pairs_.push_back({cc_a->getOwner(), cc_b->getOwner(), category_a, category_b});
+        current_contacts_.push_back({i, j, collision_pairs_.back()});
+        return std::nullopt;
     }
 
-    void PhysicsEngine::resolveTileCollisions(engine::component::PhysicsComponent *pc, float delta_time)
+    void PhysicsEngine::resolveSolidObjectCollisionsTimed(size_t move_index, size_t solid_index)
     {
-        // 检查组件是否有效
-        auto *obj = pc->getOwner();
-        if (!obj)
+        ++stats_.resolved_solids;
+        if (!stats_enabled_)
         {
+            resolveSolidObjectCollisions(move_index, solid_index);
             return;
         }
-        auto *tc = obj->getComponent<engine::component::TransformComponent>();
-        auto *cc = obj->getComponent<engine::component::ColliderComponent>();
-        if (!tc || !cc || cc->isTrigger())
+        auto start = Clock::now();
+        resolveSolidObjectCollisions(move_index, solid_index);
+        stats_.solid_resolve_us += toMicroseconds(Clock::now() - start);
+    }
+
+    void PhysicsEngine::resolveTileCollisionsSubstepped(size_t index, float delta_time)
+    {
+        // 单步位移超过阈值时拆分为多个子步，让斜坡、梯子等只在目标位置检测的逻辑在高速下依然准确
+        // （SOLID 墙体由扫掠检测保证不会被穿过，子步只是提高精度）
+        int substeps = 1;
+        if (max_substeps_ > 1 && substep_distance_ > 0.0f)
+        {
+            const auto &velocity = bodies_.velocities[index];
+            auto distance = glm::max(glm::abs(velocity.x), glm::abs(velocity.y)) * delta_time;
+            if (distance > substep_distance_)
+            {
+                substeps = glm::min(max_substeps_, static_cast<int>(std::ceil(distance / substep_distance_)));
+            }
+        }
+        auto sub_delta_time = delta_time / static_cast<float>(substeps);
+        for (int step = 0; step < substeps; ++step)
+        {
+            resolveTileCollisions(index, sub_delta_time);
+        }
+    }
+
+    std::optional<int> PhysicsEngine::sweepTiles(bool horizontal, int from, int to, int span_min, int span_max, bool block_unisolid) const
+    {
+        // 一维 DDA：沿移动方向逐格前进，每一格检查垂直方向上覆盖的所有瓦片
+        const int step = (to >= from) ? 1 : -1;
+        for (int cell = from; (to - cell) * step >= 0; cell += step)
+        {
+            for (int span = span_min; span <= span_max; ++span)
+            {
+                auto type = horizontal ? collision_grid_.getTileTypeAt({cell, span}) : collision_grid_.getTileTypeAt({span, cell});
+                if (type == engine::component::TileType::SOLID || (block_unisolid && type == engine::component::TileType::UNISOLID))
+                {
+                    return cell;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    void PhysicsEngine::resolveTileCollisions(size_t index, float delta_time)
+    {
+        // 检查物体是否有 Transform 和非触发器的碰撞器
+        auto collider_flags = bodies_.collider_flags[index];
+        if (!bodies_.transforms[index] || !(collider_flags & collider_flag::PRESENT) || (collider_flags & collider_flag::TRIGGER))
         {
             return;
         }
-        auto world_aabb = cc->getWorldAABB(); // 使用最小包围盒进行碰撞检测（简化）
+        auto world_aabb = bodies_.getWorldAABB(index); // 使用最小包围盒进行碰撞检测（简化）
         auto obj_pos = world_aabb.position;
         auto obj_size = world_aabb.size;
         if (world_aabb.size.x <= 0.0f || world_aabb.size.y <= 0.0f)
@@ -165,24 +698,25 @@ namespace engine::physics
             return;
         }
         // -- 检查结束, 正式开始处理 --
+        auto &velocity = bodies_.velocities[index];
+        auto &flags = bodies_.flags[index];
 
-        constexpr float tolerance = 1.0f;     // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
-        auto ds = pc->velocity_ * delta_time; // 计算物体在delta_time内的位移
-        auto new_obj_pos = obj_pos + ds;      // 计算物体在delta_time后的新位置
+        constexpr float tolerance = 1.0f; // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
+        auto ds = velocity * delta_time;  // 计算物体在delta_time内的位移
+        auto new_obj_pos = obj_pos + ds;  // 计算物体在delta_time后的新位置
 
-        if (!cc->isActive())
+        if (!(collider_flags & collider_flag::ACTIVE))
         { // 如果碰撞器未激活，直接让物体正常移动，然后返回。
-            tc->translate(ds);
-            pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
+            bodies_.positions[index] += ds;
+            velocity = glm::clamp(velocity, -max_speed_, max_speed_);
             return;
         }
 
         // 遍历所有注册的碰撞瓦片层
-        for (auto *layer : collision_tile_layers_)
+        // 所有碰撞图层已合并到碰撞网格中，只需查询一次
+        if (!collision_grid_.empty())
         {
-            if (!layer)
-                continue;
-            auto tile_size = layer->getTileSize();
+            auto tile_size = collision_grid_.getTileSize();
             // 轴分离碰撞检测：先检查X方向是否有碰撞 (y方向使用初始值obj_pos.y)
             if (ds.x > 0.0f)
             {
@@ -191,29 +725,36 @@ namespace engine::physics
                 auto tile_x = static_cast<int>(floor(right_top_x / tile_size.x)); // 获取x方向瓦片坐标
                 // y方向坐标有两个，右上和右下
                 auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
-                auto tile_type_top = layer->getTileTypeAt({tile_x, tile_y}); // 右上角瓦片类型
                 auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
-                auto tile_type_bottom = layer->getTileTypeAt({tile_x, tile_y_bottom}); // 右下角瓦片类型
+                // 扫掠检测：从当前所在列的下一列到目标列（包含），逐列检查整个高度范围内是否有SOLID瓦片（防止高速穿墙）
+                auto sweep_from = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x)) + 1;
+                auto hit_x = sweepTiles(true, sweep_from, tile_x, tile_y, tile_y_bottom, false);
+                if (hit_x)
+                {
+                    tile_x = hit_x.value();
+                }
+                auto tile_type_top = collision_grid_.getTileTypeAt({tile_x, tile_y}); // 右上角瓦片类型
+                auto tile_type_bottom = collision_grid_.getTileTypeAt({tile_x, tile_y_bottom}); // 右下角瓦片类型
 
-                if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID)
+                if (hit_x || tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID)
                 {
                     // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                    new_obj_pos.x = tile_x * layer->getTileSize().x - obj_size.x;
-                    pc->velocity_.x = 0.0f;
-                    pc->setCollidedRight(true);
+                    new_obj_pos.x = tile_x * tile_size.x - obj_size.x;
+                    velocity.x = 0.0f;
+                    flags |= body_flag::COLLIDED_RIGHT;
                 }
                 else
                 {
                     // 检测右下角斜坡瓦片
                     auto width_right = new_obj_pos.x + obj_size.x - tile_x * tile_size.x;
-                    auto height_right = getTileHeightAtWidth(width_right, tile_type_bottom, tile_size);
+                    auto height_right = getTileHeightAtWidth(width_right, {tile_x, tile_y_bottom});
                     if (height_right > 0.0f)
                     {
                         // 如果有碰撞（角点的世界y坐标 > 斜坡地面的世界y坐标）, 就让物体贴着斜坡表面
-                        if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right)
+                        if (new_obj_pos.y > (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_right)
                         {
-                            new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right;
-                            pc->setCollidedBelow(true);
+                            new_obj_pos.y = (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_right;
+                            flags |= body_flag::COLLIDED_BELOW;
                         }
                     }
                 }
@@ -225,28 +766,35 @@ namespace engine::physics
                 auto tile_x = static_cast<int>(floor(left_top_x / tile_size.x)); // 获取x方向瓦片坐标
                 // y方向坐标有两个，左上和左下
                 auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
-                auto tile_type_top = layer->getTileTypeAt({tile_x, tile_y}); // 左上角瓦片类型
                 auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
-                auto tile_type_bottom = layer->getTileTypeAt({tile_x, tile_y_bottom}); // 左下角瓦片类型
+                // 扫掠检测：从当前所在列的前一列到目标列（包含），逐列检查是否有SOLID瓦片
+                auto sweep_from = static_cast<int>(floor(obj_pos.x / tile_size.x)) - 1;
+                auto hit_x = sweepTiles(true, sweep_from, tile_x, tile_y, tile_y_bottom, false);
+                if (hit_x)
+                {
+                    tile_x = hit_x.value();
+                }
+                auto tile_type_top = collision_grid_.getTileTypeAt({tile_x, tile_y}); // 左上角瓦片类型
+                auto tile_type_bottom = collision_grid_.getTileTypeAt({tile_x, tile_y_bottom}); // 左下角瓦片类型
 
-                if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID)
+                if (hit_x || tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID)
                 {
                     // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                    new_obj_pos.x = (tile_x + 1) * layer->getTileSize().x;
-                    pc->velocity_.x = 0.0f;
-                    pc->setCollidedLeft(true);
+                    new_obj_pos.x = (tile_x + 1) * tile_size.x;
+                    velocity.x = 0.0f;
+                    flags |= body_flag::COLLIDED_LEFT;
                 }
                 else
                 {
                     // 检测左下角斜坡瓦片
                     auto width_left = new_obj_pos.x - tile_x * tile_size.x;
-                    auto height_left = getTileHeightAtWidth(width_left, tile_type_bottom, tile_size);
+                    auto height_left = getTileHeightAtWidth(width_left, {tile_x, tile_y_bottom});
                     if (height_left > 0.0f)
                     {
-                        if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left)
+                        if (new_obj_pos.y > (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_left)
                         {
-                            new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left;
-                            pc->setCollidedBelow(true);
+                            new_obj_pos.y = (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_left;
+                            flags |= body_flag::COLLIDED_BELOW;
                         }
                     }
                 }
@@ -259,35 +807,42 @@ namespace engine::physics
                 auto tile_y = static_cast<int>(floor(bottom_left_y / tile_size.y));
 
                 auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
-                auto tile_type_left = layer->getTileTypeAt({tile_x, tile_y}); // 左下角瓦片类型
                 auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
-                auto tile_type_right = layer->getTileTypeAt({tile_x_right, tile_y}); // 右下角瓦片类型
+                // 扫掠检测：当前底边以下到目标行（包含）的行中如有SOLID/UNISOLID瓦片，直接落在其上
+                auto sweep_from = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y)) + 1;
+                auto hit_y = sweepTiles(false, sweep_from, tile_y, tile_x, tile_x_right, true);
+                if (hit_y)
+                {
+                    tile_y = hit_y.value();
+                }
+                auto tile_type_left = collision_grid_.getTileTypeAt({tile_x, tile_y}); // 左下角瓦片类型
+                auto tile_type_right = collision_grid_.getTileTypeAt({tile_x_right, tile_y}); // 右下角瓦片类型
 
-                if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID ||
+                if (hit_y || tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID ||
                     tile_type_left == engine::component::TileType::UNISOLID || tile_type_right == engine::component::TileType::UNISOLID)
                 {
                     // 到达地面！速度归零，y方向移动到贴着地面的位置
-                    new_obj_pos.y = tile_y * layer->getTileSize().y - obj_size.y;
-                    pc->velocity_.y = 0.0f;
-                    pc->setCollidedBelow(true);
+                    new_obj_pos.y = tile_y * tile_size.y - obj_size.y;
+                    velocity.y = 0.0f;
+                    flags |= body_flag::COLLIDED_BELOW;
                     // 如果两个角点都位于梯子上，则判断是不是处在梯子顶层
                 }
                 else if (tile_type_left == engine::component::TileType::LADDER && tile_type_right == engine::component::TileType::LADDER)
                 {
-                    auto tile_type_up_l = layer->getTileTypeAt({tile_x, tile_y - 1});       // 检测左角点上方瓦片类型
-                    auto tile_type_up_r = layer->getTileTypeAt({tile_x_right, tile_y - 1}); // 检测右角点上方瓦片类型
+                    auto tile_type_up_l = collision_grid_.getTileTypeAt({tile_x, tile_y - 1});       // 检测左角点上方瓦片类型
+                    auto tile_type_up_r = collision_grid_.getTileTypeAt({tile_x_right, tile_y - 1}); // 检测右角点上方瓦片类型
                     // 如果上方不是梯子，证明处在梯子顶层
                     if (tile_type_up_r != engine::component::TileType::LADDER && tile_type_up_l != engine::component::TileType::LADDER)
                     {
                         // 通过是否使用重力来区分是否处于攀爬状态。
-                        if (pc->isUseGravity())
+                        if (bodies_.use_gravity[index])
                         {
                             // 非攀爬状态
-                            pc->setOnTopLadder(true);   // 设置在梯子顶层标志
-                            pc->setCollidedBelow(true); // 设置下方碰撞标志
+                            flags |= body_flag::ON_TOP_LADDER;   // 设置在梯子顶层标志
+                            flags |= body_flag::COLLIDED_BELOW; // 设置下方碰撞标志
                             // 让物体贴着梯子顶层位置(与SOLID情况相同)
-                            new_obj_pos.y = tile_y * layer->getTileSize().y - obj_size.y;
-                            pc->velocity_.y = 0.0f;
+                            new_obj_pos.y = tile_y * tile_size.y - obj_size.y;
+                            velocity.y = 0.0f;
                         }
                         else
                         {
@@ -299,16 +854,16 @@ namespace engine::physics
                     // 检测斜坡瓦片（下方两个角点都要检测）
                     auto width_left = obj_pos.x - tile_x * tile_size.x;
                     auto width_right = obj_pos.x + obj_size.x - tile_x_right * tile_size.x;
-                    auto height_left = getTileHeightAtWidth(width_left, tile_type_left, tile_size);
-                    auto height_right = getTileHeightAtWidth(width_right, tile_type_right, tile_size);
+                    auto height_left = getTileHeightAtWidth(width_left, {tile_x, tile_y});
+                    auto height_right = getTileHeightAtWidth(width_right, {tile_x_right, tile_y});
                     auto height = glm::max(height_left, height_right); // 找到两个角点的最高点进行检测
                     if (height > 0.0f)
                     { // 说明至少有一个角点处于斜坡瓦片
-                        if (new_obj_pos.y > (tile_y + 1) * layer->getTileSize().y - obj_size.y - height)
+                        if (new_obj_pos.y > (tile_y + 1) * tile_size.y - obj_size.y - height)
                         {
-                            new_obj_pos.y = (tile_y + 1) * layer->getTileSize().y - obj_size.y - height;
-                            pc->velocity_.y = 0.0f; // 只有向下运动时才需要让 y 速度归零
-                            pc->setCollidedBelow(true);
+                            new_obj_pos.y = (tile_y + 1) * tile_size.y - obj_size.y - height;
+                            velocity.y = 0.0f; // 只有向下运动时才需要让 y 速度归零
+                            flags |= body_flag::COLLIDED_BELOW;
                         }
                     }
                 }
@@ -320,36 +875,42 @@ namespace engine::physics
                 auto tile_y = static_cast<int>(floor(top_left_y / tile_size.y));
 
                 auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
-                auto tile_type_left = layer->getTileTypeAt({tile_x, tile_y}); // 左上角瓦片类型
                 auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
-                auto tile_type_right = layer->getTileTypeAt({tile_x_right, tile_y}); // 右上角瓦片类型
+                // 扫掠检测：当前顶边以上到目标行（包含）的行中如有SOLID瓦片，直接撞在其下方
+                auto sweep_from = static_cast<int>(floor(obj_pos.y / tile_size.y)) - 1;
+                auto hit_y = sweepTiles(false, sweep_from, tile_y, tile_x, tile_x_right, false);
+                if (hit_y)
+                {
+                    tile_y = hit_y.value();
+                }
+                auto tile_type_left = collision_grid_.getTileTypeAt({tile_x, tile_y}); // 左上角瓦片类型
+                auto tile_type_right = collision_grid_.getTileTypeAt({tile_x_right, tile_y}); // 右上角瓦片类型
 
-                if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID)
+                if (hit_y || tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID)
                 {
                     // 撞到天花板！速度归零，y方向移动到贴着天花板的位置
-                    new_obj_pos.y = (tile_y + 1) * layer->getTileSize().y;
-                    pc->velocity_.y = 0.0f;
-                    pc->setCollidedAbove(true);
+                    new_obj_pos.y = (tile_y + 1) * tile_size.y;
+                    velocity.y = 0.0f;
+                    flags |= body_flag::COLLIDED_ABOVE;
                 }
             }
         }
         // 更新物体位置，并限制最大速度
-        tc->translate(new_obj_pos - obj_pos); // 使用translate方法，避免直接设置位置，因为碰撞盒可能有偏移量
-        pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
+        bodies_.positions[index] += new_obj_pos - obj_pos; // 使用位移量更新，避免直接设置位置，因为碰撞盒可能有偏移量
+        velocity = glm::clamp(velocity, -max_speed_, max_speed_);
     }
 
-    void PhysicsEngine::resolveSolidObjectCollisions(engine::object::GameObject *move_obj, engine::object::GameObject *solid_obj)
+    void PhysicsEngine::resolveSolidObjectCollisions(size_t move_index, size_t solid_index)
     {
         // 进入此函数前，已经检查了各个组件的有效性，因此直接进行计算
-        auto *move_tc = move_obj->getComponent<engine::component::TransformComponent>();
-        auto *move_pc = move_obj->getComponent<engine::component::PhysicsComponent>();
-        auto *move_cc = move_obj->getComponent<engine::component::ColliderComponent>();
-        auto *solid_cc = solid_obj->getComponent<engine::component::ColliderComponent>();
+        auto *move_tc = bodies_.transforms[move_index];
+        auto &move_velocity = bodies_.velocities[move_index];
+        auto &move_flags = bodies_.flags[move_index];
 
         // 这里只能获取期望位置，无法获取当前帧初始位置，因此无法进行轴分离碰撞检测
         /* 未来可以进行重构，让这里可以获取初始位置。但是我们展示另外一种处理方法 */
-        auto move_aabb = move_cc->getWorldAABB();
-        auto solid_aabb = solid_cc->getWorldAABB();
+        auto move_aabb = bodies_.getWorldAABB(move_index);
+        auto solid_aabb = bodies_.getWorldAABB(solid_index);
 
         // --- 使用最小平移向量解决碰撞问题 ---
         auto move_center = move_aabb.position + move_aabb.size / 2.0f;
@@ -368,21 +929,23 @@ namespace engine::physics
             {
                 // 移动物体在左边，让它贴着右边SOLID物体（相当于向左移出重叠部分），y方向正常移动
                 move_tc->translate(glm::vec2(-overlap.x, 0.0f));
+                bodies_.positions[move_index] = move_tc->getPosition();
                 // 如果速度为正(向右移动)，则归零 （if判断不可少，否则可能出现错误吸附）
-                if (move_pc->velocity_.x > 0.0f)
+                if (move_velocity.x > 0.0f)
                 {
-                    move_pc->velocity_.x = 0.0f;
-                    move_pc->setCollidedRight(true);
+                    move_velocity.x = 0.0f;
+                    move_flags |= body_flag::COLLIDED_RIGHT;
                 }
             }
             else
             {
                 // 移动物体在右边，让它贴着左边SOLID物体（相当于向右移出重叠部分），y方向正常移动
                 move_tc->translate(glm::vec2(overlap.x, 0.0f));
-                if (move_pc->velocity_.x < 0.0f)
+                bodies_.positions[move_index] = move_tc->getPosition();
+                if (move_velocity.x < 0.0f)
                 {
-                    move_pc->velocity_.x = 0.0f;
-                    move_pc->setCollidedLeft(true);
+                    move_velocity.x = 0.0f;
+                    move_flags |= body_flag::COLLIDED_LEFT;
                 }
             }
         }
@@ -393,162 +956,455 @@ namespace engine::physics
             {
                 // 移动物体在上面，让它贴着下面SOLID物体（相当于向上移出重叠部分），x方向正常移动
                 move_tc->translate(glm::vec2(0.0f, -overlap.y));
-                if (move_pc->velocity_.y > 0.0f)
+                bodies_.positions[move_index] = move_tc->getPosition();
+                if (move_velocity.y > 0.0f)
                 {
-                    move_pc->velocity_.y = 0.0f;
-                    move_pc->setCollidedBelow(true);
+                    move_velocity.y = 0.0f;
+                    move_flags |= body_flag::COLLIDED_BELOW;
                 }
             }
             else
             {
                 // 移动物体在下面，让它贴着上面SOLID物体（相当于向下移出重叠部分），x方向正常移动
                 move_tc->translate(glm::vec2(0.0f, overlap.y));
-                if (move_pc->velocity_.y < 0.0f)
+                bodies_.positions[move_index] = move_tc->getPosition();
+                if (move_velocity.y < 0.0f)
                 {
-                    move_pc->velocity_.y = 0.0f;
-                    move_pc->setCollidedAbove(true);
+                    move_velocity.y = 0.0f;
+                    move_flags |= body_flag::COLLIDED_ABOVE;
                 }
             }
         }
     }
 
-    float PhysicsEngine::getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tile_size)
+    float PhysicsEngine::getTileHeightAtWidth(float width, glm::ivec2 tile) const
+    {
+        // 非斜坡瓦片的轮廓编号为 NONE，高度为0
+        return height_profiles_.getHeight(collision_grid_.getHeightProfileAt(tile), width);
+    }
+
+    void PhysicsEngine::checkTileTriggers()
     {
-        auto rel_x = glm::clamp(width / tile_size.x, 0.0f, 1.0f);
-        switch (type)
+        for (size_t i = 0; i < bodies_.size(); ++i)
         {
-        case engine::component::TileType::SLOPE_0_1: // 左0  右1
+            constexpr std::uint8_t required = collider_flag::PRESENT | collider_flag::ACTIVE;
+            if (!bodies_.enabled[i] || (bodies_.collider_flags[i] & required) != required || (bodies_.collider_flags[i] & collider_flag::TRIGGER))
+            {
+                continue; // 如果游戏对象本就是触发器，则不需要检查瓦片触发事件
+            }
+            if (bodies_.types[i] == BodyType::STATIC)
+            {
+                continue; // 静态物体不会进入或离开瓦片（休眠物体仍需检测，例如静止站在尖刺上）
+            }
+            auto *obj = bodies_.components[i]->getOwner();
+            if (!obj)
+            {
+                continue;
+            }
+            if (collision_grid_.empty())
+            {
+                continue;
+            }
+            // 获取物体的世界AABB
+            auto world_aabb = bodies_.getWorldAABB(i);
+            auto tile_size = collision_grid_.getTileSize();
+            constexpr float tolerance = 1.0f; // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
+            // 获取瓦片坐标范围
+            auto start_x = static_cast<int>(floor(world_aabb.position.x / tile_size.x));
+            auto end_x = static_cast<int>(ceil((world_aabb.position.x + world_aabb.size.x - tolerance) / tile_size.x));
+            auto start_y = static_cast<int>(floor(world_aabb.position.y / tile_size.y));
+            auto end_y = static_cast<int>(ceil((world_aabb.position.y + world_aabb.size.y - tolerance) / tile_size.y));
+
+            // 与预先计算的触发器区间求交，每种类型只占一位（例如同时踩到两个尖刺，只需要受到一次伤害）
+            auto mask = collision_grid_.getTriggerMask({start_x, start_y}, {end_x, end_y});
+            // 梯子类型不必记录到事件容器，物理引擎自己处理
+            if (mask & CollisionGrid::tileTypeBit(engine::component::TileType::LADDER))
+            {
+                bodies_.flags[i] |= body_flag::COLLIDED_LADDER;
+            }
+            // 未来可以添加更多触发器类型的瓦片，目前只有 HAZARD 类型
+            if (mask & CollisionGrid::tileTypeBit(engine::component::TileType::HAZARD))
+            {
+                tile_trigger_events_.emplace_back(obj, engine::component::TileType::HAZARD);
+            }
+        }
+    }
+
+    void PhysicsEngine::updateSleepStates(float delta_time)
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i)
         {
-            return rel_x * tile_size.y;
+            if (!bodies_.enabled[i] || bodies_.types[i] != BodyType::DYNAMIC || bodies_.sleeping[i])
+            {
+                continue;
+            }
+            const auto &velocity = bodies_.velocities[i];
+            if (glm::abs(velocity.x) < sleep_velocity_threshold_ && glm::abs(velocity.y) < sleep_velocity_threshold_)
+            {
+                // 速度持续低于阈值一段时间后进入休眠
+                bodies_.sleep_timers[i] += delta_time;
+                if (bodies_.sleep_timers[i] >= sleep_time_)
+                {
+                    bodies_.sleeping[i] = 1;
+                    bodies_.velocities[i] = {0.0f, 0.0f};
+                }
+            }
+            else
+            {
+                bodies_.sleep_timers[i] = 0.0f;
+            }
         }
-        case engine::component::TileType::SLOPE_0_2: // 左0  右1/2
+    }
+
+    RaycastHit PhysicsEngine::raycast(const RaycastQuery &query) const
+    {
+        RaycastHit best;
+        auto length = glm::length(query.direction);
+        if (length <= 0.0f || query.max_distance < 0.0f)
         {
-            return rel_x * tile_size.y * 0.5f;
+            return best;
         }
-        case engine::component::TileType::SLOPE_2_1: // 左1/2右1
+        auto direction = query.direction / length;
+        if (query.hit_tiles)
         {
-            return rel_x * tile_size.y * 0.5f + tile_size.y * 0.5f;
+            best = raycastTiles(query.origin, direction, query.max_distance);
         }
-        case engine::component::TileType::SLOPE_1_0: // 左1  右0
+        if (query.object_mask != category::NONE)
         {
-            return (1.0f - rel_x) * tile_size.y;
+            castObjects(query.origin, direction, query.max_distance, {0.0f, 0.0f}, query.object_mask, query.hit_triggers, query.ignore, best);
         }
-        case engine::component::TileType::SLOPE_2_0: // 左1/2右0
+        return best;
+    }
+
+    RaycastHit PhysicsEngine::boxCast(const BoxCastQuery &query) const
+    {
+        RaycastHit best;
+        auto length = glm::length(query.direction);
+        if (length <= 0.0f || query.max_distance < 0.0f)
         {
-            return (1.0f - rel_x) * tile_size.y * 0.5f;
+            return best;
         }
-        case engine::component::TileType::SLOPE_1_2: // 左1  右1/2
+        auto direction = query.direction / length;
+        if (query.hit_tiles)
         {
-            return (1.0f - rel_x) * tile_size.y * 0.5f + tile_size.y * 0.5f;
+            best = boxCastTiles(query.box, direction, query.max_distance);
         }
-        default:
+        if (query.object_mask != category::NONE)
         {
-            return 0.0f; // 默认返回0，表示没有斜坡}
+            castObjects(query.box.position, direction, query.max_distance, query.box.size, query.object_mask, query.hit_triggers, query.ignore, best);
         }
+        return best;
+    }
+
+    void PhysicsEngine::raycastBatch(std::span<const RaycastQuery> queries, std::span<RaycastHit> results) const
+    {
+        auto count = std::min(queries.size(), results.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            results[i] = raycast(queries[i]);
         }
     }
 
-    void PhysicsEngine::checkTileTriggers()
+    void PhysicsEngine::boxCastBatch(std::span<const BoxCastQuery> queries, std::span<RaycastHit> results) const
     {
-        for (auto *pc : components_)
+        auto count = std::min(queries.size(), results.size());
+        for (size_t i = 0; i < count; ++i)
         {
-            if (!pc || !pc->isEnabled())
+            results[i] = boxCast(queries[i]);
+        }
+    }
+
+    size_t PhysicsEngine::overlapAABB(const engine::utils::Rect &aabb, std::uint32_t object_mask, std::vector<engine::object::GameObject *> &out,
+                                      bool include_triggers) const
+    {
+        out.clear();
+        constexpr std::uint8_t required = collider_flag::PRESENT | collider_flag::ACTIVE;
+        auto test = [&](size_t i)
+        {
+            auto collider_flags = bodies_.collider_flags[i];
+            if (!bodies_.enabled[i] || (collider_flags & required) != required ||
+                (!include_triggers && (collider_flags & collider_flag::TRIGGER)) ||
+                !(bodies_.colliders[i]->getCategory() & object_mask))
             {
-                continue; // 检查组件是否有效和启用
+                return;
             }
-            auto *obj = pc->getOwner();
-            if (!obj)
+            auto other = bodies_.getWorldAABB(i);
+            if (aabb.position.x < other.position.x + other.size.x && aabb.position.x + aabb.size.x > other.position.x &&
+                aabb.position.y < other.position.y + other.size.y && aabb.position.y + aabb.size.y > other.position.y)
             {
-                continue;
+                out.push_back(bodies_.components[i]->getOwner());
+            }
+        };
+        if (queryBroadphase(aabb))
+        {
+            for (auto i : query_candidates_)
+                test(i);
+        }
+        else
+        {
+            for (size_t i = 0; i < bodies_.size(); ++i)
+                test(i);
+        }
+        return out.size();
+    }
+
+    RaycastHit PhysicsEngine::raycastTiles(glm::vec2 origin, glm::vec2 direction, float max_distance) const
+    {
+        RaycastHit hit;
+        if (collision_grid_.empty())
+        {
+            return hit;
+        }
+        auto tile_size = glm::vec2(collision_grid_.getTileSize());
+        // 网格之外全是空白瓦片，检测距离不必超过到网格最远处的距离
+        auto grid_extent = glm::vec2(collision_grid_.getMapSize()) * tile_size;
+        max_distance = std::min(max_distance, glm::length(origin - grid_extent * 0.5f) + glm::length(grid_extent));
+        // --- 网格 DDA 初始化 ---
+        auto cell = glm::ivec2(glm::floor(origin / tile_size));
+        glm::ivec2 step = {0, 0};
+        glm::vec2 t_next = {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()}; // 到达下一条网格线的距离
+        glm::vec2 t_delta = t_next;                                                                          // 穿过一格需要的距离
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            if (direction[axis] > 0.0f)
+            {
+                step[axis] = 1;
+                t_next[axis] = ((cell[axis] + 1) * tile_size[axis] - origin[axis]) / direction[axis];
+                t_delta[axis] = tile_size[axis] / direction[axis];
             }
-            auto *cc = obj->getComponent<engine::component::ColliderComponent>();
-            if (!cc || !cc->isActive() || cc->isTrigger())
+            else if (direction[axis] < 0.0f)
             {
-                continue; // 如果游戏对象本就是触发器，则不需要检查瓦片触发事件
+                step[axis] = -1;
+                t_next[axis] = (cell[axis] * tile_size[axis] - origin[axis]) / direction[axis];
+                t_delta[axis] = -tile_size[axis] / direction[axis];
             }
-            // 获取物体的世界AABB
-            auto world_aabb = cc->getWorldAABB();
+        }
 
-            // 使用 set 来跟踪循环遍历中已经触发过的瓦片类型，防止重复添加（例如，玩家同时踩到两个尖刺，只需要受到一次伤害）
-            std::set<engine::component::TileType> triggers_set;
+        float t = 0.0f;     // 进入当前格子时的距离
+        int last_axis = -1; // 进入当前格子时跨越的坐标轴（-1 表示起点所在格子）
+        while (t <= max_distance)
+        {
+            auto t_exit = std::min({t_next.x, t_next.y, max_distance});
+            auto type = collision_grid_.getTileTypeAt(cell);
+            std::optional<float> t_hit;
+            glm::vec2 normal = (last_axis < 0) ? -direction : glm::vec2(0.0f, 0.0f);
+            if (last_axis >= 0)
+            {
+                normal[last_axis] = static_cast<float>(-step[last_axis]);
+            }
 
-            // 遍历所有注册的碰撞瓦片层分别进行检测
-            for (auto *layer : collision_tile_layers_)
+            if (type == engine::component::TileType::SOLID)
             {
-                if (!layer)
-                    continue;
-                auto tile_size = layer->getTileSize();
-                constexpr float tolerance = 1.0f; // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
-                // 获取瓦片坐标范围
-                auto start_x = static_cast<int>(floor(world_aabb.position.x / tile_size.x));
-                auto end_x = static_cast<int>(ceil((world_aabb.position.x + world_aabb.size.x - tolerance) / tile_size.x));
-                auto start_y = static_cast<int>(floor(world_aabb.position.y / tile_size.y));
-                auto end_y = static_cast<int>(ceil((world_aabb.position.y + world_aabb.size.y - tolerance) / tile_size.y));
-
-                // 遍历瓦片坐标范围进行检测
-                for (int x = start_x; x < end_x; ++x)
+                t_hit = t;
+            }
+            else if (type == engine::component::TileType::UNISOLID)
+            {
+                if (last_axis == 1 && step.y > 0)
+                    t_hit = t; // 只有从上方进入才阻挡
+            }
+            else if (HeightProfileTable::isSlope(type))
+            {
+                // 斜坡：内置斜坡的表面高度在格子内随 x 线性变化，射线在格子内的“深度”也是线性的，求出穿过表面的位置
+                // （自定义的曲面轮廓在格子内按线性近似）
+                auto cell_left = cell.x * tile_size.x;
+                auto cell_bottom = (cell.y + 1) * tile_size.y;
+                auto depth = [&](float distance)
                 {
-                    for (int y = start_y; y < end_y; ++y)
-                    {
-                        auto tile_type = layer->getTileTypeAt({x, y});
-                        // 未来可以添加更多触发器类型的瓦片，目前只有 HAZARD 类型
-                        if (tile_type == engine::component::TileType::HAZARD)
-                        {
-                            triggers_set.insert(tile_type); // 记录触发事件，set 保证每个瓦片类型只记录一次
-                        }
-                        // 梯子类型不必记录到事件容器，物理引擎自己处理
-                        else if (tile_type == engine::component::TileType::LADDER)
-                        {
-                            pc->setCollidedLadder(true);
-                        }
-                    }
+                    auto p = origin + direction * distance;
+                    return p.y - (cell_bottom - getTileHeightAtWidth(p.x - cell_left, cell));
+                };
+                auto depth_enter = depth(t);
+                auto depth_exit = depth(t_exit);
+                if (depth_enter >= 0.0f)
+                {
+                    t_hit = t;
                 }
-                // 遍历触发事件集合，添加到 tile_trigger_events_ 中
-                for (const auto &type : triggers_set)
+                else if (depth_exit >= 0.0f)
                 {
-                    tile_trigger_events_.emplace_back(obj, type);
-                    spdlog::trace("tile_trigger_events_中 添加了 GameObject {} 和瓦片触发类型: {}", obj->getName(), static_cast<int>(type));
+                    t_hit = t + (t_exit - t) * (-depth_enter) / (depth_exit - depth_enter);
+                    // 法线取命中点附近一个像素宽度内的表面斜率
+                    auto hit_x = origin.x + direction.x * t_hit.value() - cell_left;
+                    auto dh = getTileHeightAtWidth(hit_x + 0.5f, cell) - getTileHeightAtWidth(hit_x - 0.5f, cell);
+                    normal = glm::normalize(glm::vec2(-dh, -1.0f));
                 }
             }
+
+            if (t_hit && t_hit.value() <= max_distance)
+            {
+                hit.hit = true;
+                hit.distance = t_hit.value();
+                hit.point = origin + direction * hit.distance;
+                hit.normal = normal;
+                hit.tile_type = type;
+                return hit;
+            }
+
+            // 前进到下一个格子
+            if (t_next.x < t_next.y)
+            {
+                t = t_next.x;
+                t_next.x += t_delta.x;
+                cell.x += step.x;
+                last_axis = 0;
+            }
+            else
+            {
+                t = t_next.y;
+                t_next.y += t_delta.y;
+                cell.y += step.y;
+                last_axis = 1;
+            }
+        }
+        return hit;
+    }
+
+    RaycastHit PhysicsEngine::boxCastTiles(const engine::utils::Rect &box, glm::vec2 direction, float max_distance) const
+    {
+        RaycastHit hit;
+        if (static_geometry_.empty())
+        {
+            return hit;
+        }
+        auto tile_size = glm::vec2(collision_grid_.getTileSize());
+        // 矩形扫过的范围内的所有静态矩形
+        auto end_position = box.position + direction * max_distance;
+        auto swept_min = glm::min(box.position, end_position);
+        auto swept_max = glm::max(box.position, end_position) + box.size;
+        // 网格之外没有静态矩形，只需查询与网格重叠的部分
+        auto grid_max = collision_grid_.getMapSize() - 1;
+        auto start = glm::clamp(glm::ivec2(glm::floor(swept_min / tile_size)), glm::ivec2(0), grid_max);
+        auto end = glm::clamp(glm::ivec2(glm::floor(swept_max / tile_size)), glm::ivec2(0), grid_max);
+
+        auto best_distance = max_distance;
+        auto testBox = [&](const StaticGeometry::Box &solid)
+        {
+            if (solid.type == engine::component::TileType::UNISOLID)
+            {
+                // 单向平台只阻挡向下移动、且起始时底边不低于平台顶面的矩形
+                if (direction.y <= 0.0f || box.position.y + box.size.y > solid.rect.position.y)
+                    return;
+            }
+            // 矩形左上角的运动轨迹与“静态矩形按投射矩形尺寸扩展”后的区域求交
+            float t = 0.0f;
+            glm::vec2 normal;
+            if (intersectRayAABB(box.position, direction, solid.rect.position - box.size, solid.rect.position + solid.rect.size, best_distance, t, normal) &&
+                (!hit.hit || t < hit.distance))
+            {
+                hit.hit = true;
+                hit.distance = t;
+                hit.normal = (normal == glm::vec2(0.0f, 0.0f)) ? -direction : normal;
+                hit.tile_type = solid.type;
+                best_distance = t;
+            }
+        };
+        static_geometry_.forEachOverlapping(start, end, testBox);
+        if (hit.hit)
+        {
+            hit.point = box.position + direction * hit.distance;
+        }
+        return hit;
+    }
+
+    void PhysicsEngine::castObjects(glm::vec2 origin, glm::vec2 direction, float max_distance, glm::vec2 extent, std::uint32_t object_mask,
+                                    bool hit_triggers, const engine::object::GameObject *ignore, RaycastHit &best) const
+    {
+        constexpr std::uint8_t required = collider_flag::PRESENT | collider_flag::ACTIVE;
+        auto test = [&](size_t i)
+        {
+            auto collider_flags = bodies_.collider_flags[i];
+            if (!bodies_.enabled[i] || (collider_flags & required) != required ||
+                (!hit_triggers && (collider_flags & collider_flag::TRIGGER)) ||
+                !(bodies_.colliders[i]->getCategory() & object_mask))
+            {
+                return;
+            }
+            auto *owner = bodies_.components[i]->getOwner();
+            if (!owner || owner == ignore)
+            {
+                return;
+            }
+            auto aabb = bodies_.getWorldAABB(i);
+            float t = 0.0f;
+            glm::vec2 normal;
+            auto limit = best.hit ? best.distance : max_distance;
+            if (intersectRayAABB(origin, direction, aabb.position - extent, aabb.position + aabb.size, limit, t, normal) && (!best.hit || t < best.distance))
+            {
+                best.hit = true;
+                best.distance = t;
+                best.point = origin + direction * t;
+                best.normal = (normal == glm::vec2(0.0f, 0.0f)) ? -direction : normal;
+                best.tile_type = engine::component::TileType::EMPTY;
+                best.object = owner;
+            }
+        };
+        // 粗检测范围为投射起点与终点处矩形的并集（候选按下标升序，命中距离相同时的结果与遍历一致）
+        auto reach = best.hit ? best.distance : max_distance;
+        auto end = origin + direction * reach;
+        auto swept_min = glm::min(origin, end);
+        auto swept = engine::utils::Rect{swept_min, glm::max(origin, end) + extent - swept_min};
+        if (queryBroadphase(swept))
+        {
+            for (auto i : query_candidates_)
+                test(i);
+        }
+        else
+        {
+            for (size_t i = 0; i < bodies_.size(); ++i)
+                test(i);
+        }
+    }
+
+    bool PhysicsEngine::queryBroadphase(const engine::utils::Rect &aabb) const
+    {
+        if (!broadphase_enabled_ || !broadphase_valid_)
+        {
+            return false;
+        }
+        // 范围覆盖的网格单元比物体还多时（例如无限远的射线），直接遍历更快
+        auto cells = (aabb.size + broadphase_.getCellSize()) / broadphase_.getCellSize();
+        if (!std::isfinite(cells.x) || !std::isfinite(cells.y) || cells.x * cells.y > static_cast<float>(bodies_.size()))
+        {
+            return false;
         }
+        broadphase_.query(aabb, query_candidates_);
+        return true;
     }
 
-    void PhysicsEngine::applyWorldBounds(engine::component::PhysicsComponent *pc)
+    void PhysicsEngine::applyWorldBounds(size_t index)
     {
-        if (!pc || !world_bounds_)
+        if (!world_bounds_ || !bodies_.transforms[index] || !(bodies_.collider_flags[index] & collider_flag::PRESENT))
             return;
 
         // 只限定左、上、右边界，不限定下边界，以碰撞盒作为判断依据
-        auto *obj = pc->getOwner();
-        auto *cc = obj->getComponent<engine::component::ColliderComponent>();
-        auto *tc = obj->getComponent<engine::component::TransformComponent>();
-        auto world_aabb = cc->getWorldAABB();
+        auto &velocity = bodies_.velocities[index];
+        auto &flags = bodies_.flags[index];
+        auto world_aabb = bodies_.getWorldAABB(index);
         auto obj_pos = world_aabb.position;
         auto obj_size = world_aabb.size;
 
         // 检查左边界
         if (obj_pos.x < world_bounds_->position.x)
         {
-            pc->velocity_.x = 0.0f;
+            velocity.x = 0.0f;
             obj_pos.x = world_bounds_->position.x;
-            pc->setCollidedLeft(true);
+            flags |= body_flag::COLLIDED_LEFT;
         }
         // 检查上边界
         if (obj_pos.y < world_bounds_->position.y)
         {
-            pc->velocity_.y = 0.0f;
+            velocity.y = 0.0f;
             obj_pos.y = world_bounds_->position.y;
-            pc->setCollidedAbove(true);
+            flags |= body_flag::COLLIDED_ABOVE;
         }
         // 检查右边界
         if (obj_pos.x + obj_size.x > world_bounds_->position.x + world_bounds_->size.x)
         {
-            pc->velocity_.x = 0.0f;
+            velocity.x = 0.0f;
             obj_pos.x = world_bounds_->position.x + world_bounds_->size.x - obj_size.x;
-            pc->setCollidedRight(true);
+            flags |= body_flag::COLLIDED_RIGHT;
         }
-        // 更新物体位置(使用translate方法，新位置 - 旧位置)
-        tc->translate(obj_pos - world_aabb.position);
+        // 更新物体位置(新位置 - 旧位置)
+        bodies_.positions[index] += obj_pos - world_aabb.position;
     }
 
 } // namespace engine::physics
\ No newline at end of file
@@ -1,13 +1,26 @@
 #pragma once
 #include "../utils/math.h"
+#include "spatial_hash.h"
+#include "body_storage.h"
+#include "collision_grid.h"
+#include "height_profile_table.h"
+#include "static_geometry.h"
+#include "physics_query.h"
+#include "physics_stats.h"
+#include "../core/worker_pool.h"
+#include <memory>
+#include <mutex>
 #include <vector>
+#include <span>
 #include <utility> // for std::pair
 #include <optional>
+#include <cstdint>
 #include <glm/vec2.hpp>
 
 namespace engine::component
 {
     class PhysicsComponent;
+    class ColliderComponent;
     class TileLayerComponent;
     enum class TileType;
 }
@@ -20,23 +33,80 @@ namespace engine::object
 namespace engine::physics
 {
 
+    /**
+     * @brief 一次对象间碰撞的记录，附带双方的碰撞类别位，方便游戏逻辑按整数分派。
+     */
+    struct CollisionPair
+    {
+        engine::object::GameObject *first = nullptr;
+        engine::object::GameObject *second = nullptr;
+        std::uint32_t first_category = 0;  ///< @brief first 的碰撞类别位
+        std::uint32_t second_category = 0; ///< @brief second 的碰撞类别位
+    };
+
     /**
      * @brief 负责管理和模拟物理行为及碰撞检测。
      */
     class PhysicsEngine
     {
     private:
-        std::vector<engine::component::PhysicsComponent *> components_;              ///< @brief 注册的物理组件容器，非拥有指针
+        /// @brief 持续存在的接触记录，以物体下标对 (first_index < second_index) 作为键
+        struct Contact
+        {
+            size_t first_index = 0;
+            size_t second_index = 0;
+            CollisionPair pair;
+        };
+
+        BodyStorage bodies_;                                                         ///< @brief 所有注册物体的模拟数据（结构数组，下标即物体编号）
         std::vector<engine::component::TileLayerComponent *> collision_tile_layers_; ///< @brief 注册的碰撞瓦片图层容器
+        CollisionGrid collision_grid_;                                               ///< @brief 所有碰撞瓦片图层合并后的紧凑网格（物理中的瓦片查询都使用它）
+        HeightProfileTable height_profiles_;                                         ///< @brief 斜坡高度轮廓表（按碰撞网格的瓦片尺寸烘焙）
+        StaticGeometry static_geometry_;                                             ///< @brief 碰撞网格中 SOLID / UNISOLID 瓦片合并成的静态矩形（随碰撞网格重建）
         glm::vec2 gravity_ = {0.0f, 980.0f};                                         ///< @brief 默认重力值 (像素/秒^2, 相当于100像素对应现实1m)
         float max_speed_ = 500.0f;                                                   ///< @brief 最大速度 (像素/秒)
         std::optional<engine::utils::Rect> world_bounds_;                            ///< @brief 世界边界，用于限制物体移动范围
+        float sleep_velocity_threshold_ = 1.0f;                                      ///< @brief 低于此速度 (像素/秒) 的动态物体开始累计休眠时间
+        float sleep_time_ = 0.5f;                                                    ///< @brief 速度持续低于阈值多久 (秒) 后进入休眠
+        int max_substeps_ = 4;                                                       ///< @brief 瓦片碰撞单帧最多拆分的子步数（1 表示不拆分）
+        float substep_distance_ = 8.0f;                                              ///< @brief 单步位移超过此距离 (像素) 时拆分子步
+        std::unique_ptr<engine::core::WorkerPool> worker_pool_;                      ///< @brief 并行处理物体时使用的工作线程池（为空时只使用串行路径）
+        size_t parallel_threshold_ = 256;                                            ///< @brief 物体数量达到此值时才使用并行路径
+
+        // --- 确定性模式 (用于录像回放与帧同步) ---
+        bool deterministic_ = false;                                                 ///< @brief 是否启用确定性模式（使用固定步长，并在每步结束时计算世界状态校验和）
+        float fixed_delta_time_ = 1.0f / 60.0f;                                      ///< @brief 确定性模式下每步使用的时间（忽略传入的帧时间）
+        bool fixed_point_ = false;                                                   ///< @brief 是否在每步结束时把移动物体的位置和速度量化到定点数网格
+        std::uint64_t step_count_ = 0;                                               ///< @brief 已模拟的步数
+        std::uint64_t step_checksum_ = 0;                                            ///< @brief 最近一步结束时的世界状态校验和（仅确定性模式）
+
+        // --- 性能统计 ---
+        bool stats_enabled_ = false;                                                 ///< @brief 是否测量各阶段耗时（计数总是统计）
+        PhysicsStats stats_;                                                         ///< @brief 本步的统计（每次 update 开始时清零）
+        std::mutex stats_mutex_;                                                     ///< @brief 并行路径下合并各线程耗时时使用
+        std::vector<PhysicsStats> stats_history_;                                    ///< @brief 最近若干步统计的环形缓冲区（容量为0时不记录）
+        size_t stats_history_size_ = 0;                                              ///< @brief 环形缓冲区的容量（步数）
+        size_t stats_history_next_ = 0;                                              ///< @brief 下一条记录写入的位置
+
+        bool broadphase_enabled_ = true;                                             ///< @brief 是否使用空间哈希粗检测（关闭时退回两两遍历）
+        SpatialHash broadphase_;                                                     ///< @brief 对象碰撞粗检测用的空间哈希（每次检测时重建）
+        std::vector<engine::component::ColliderComponent *> active_colliders_;       ///< @brief 与 bodies_ 一一对应的有效碰撞器缓存（无效为 nullptr）
+        std::vector<size_t> broadphase_candidates_;                                  ///< @brief 粗检测查询结果的临时容器，复用以避免每帧分配
+        bool broadphase_valid_ = false;                                              ///< @brief 空间哈希中的下标是否仍与 bodies_ 对应（注册/注销物体后失效，直到下一次检测）
+        mutable std::vector<size_t> query_candidates_;                               ///< @brief 射线/重叠查询使用的粗检测结果容器
 
         /// @brief 存储本帧发生的 GameObject 碰撞对 （每次 update 开始时清空）
-        std::vector<std::pair<engine::object::GameObject *, engine::object::GameObject *>> collision_pairs_;
+        std::vector<CollisionPair> collision_pairs_;
         /// @brief 存储本帧发生的瓦片触发事件 (GameObject*, 触发的瓦片类型, 每次 update 开始时清空)
         std::vector<std::pair<engine::object::GameObject *, engine::component::TileType>> tile_trigger_events_;
 
+        // --- 持久接触缓存 (两个容器交替使用，接触不变时不会分配内存) ---
+        std::vector<Contact> contacts_;                   ///< @brief 上一步结束时的所有接触（按下标对排序）
+        std::vector<Contact> current_contacts_;           ///< @brief 本步检测到的接触（临时容器）
+        std::vector<CollisionPair> contact_enter_events_; ///< @brief 本步新开始的接触
+        std::vector<CollisionPair> contact_stay_events_;  ///< @brief 本步仍然保持的接触
+        std::vector<CollisionPair> contact_exit_events_;  ///< @brief 本步结束的接触
+
     public:
         PhysicsEngine() = default;
 
@@ -48,13 +118,19 @@ namespace engine::physics
 
         void registerComponent(engine::component::PhysicsComponent *component);   ///< @brief 注册物理组件
         void unregisterComponent(engine::component::PhysicsComponent *component); ///< @brief 注销物理组件
+        /// @brief 重新缓存物理组件所在 GameObject 的 Transform/Collider 组件指针
+        void refreshComponentCache(engine::component::PhysicsComponent *component);
 
         // 如果瓦片层需要进行碰撞检测则注册。（不需要则不必注册）
         void registerCollisionLayer(engine::component::TileLayerComponent *layer);   ///< @brief 注册用于碰撞检测的 TileLayerComponent
         void unregisterCollisionLayer(engine::component::TileLayerComponent *layer); ///< @brief 注销用于碰撞检测的 TileLayerComponent
+        void refreshCollisionLayers();                                               ///< @brief 碰撞瓦片图层的瓦片被修改后，重建碰撞网格和静态矩形
 
         void update(float delta_time); ///< @brief 核心循环：更新所有注册的物理组件的状态
 
+        BodyStorage &getBodyStorage() { return bodies_; }             ///< @brief 获取物体数据（供 PhysicsComponent 访问自己的数据）
+        const BodyStorage &getBodyStorage() const { return bodies_; } ///< @brief 获取物体数据
+
         // 设置器/获取器
         void setGravity(glm::vec2 gravity) { gravity_ = std::move(gravity); }                              ///< @brief 设置全局重力加速度
         const glm::vec2 &getGravity() const { return gravity_; }                                           ///< @brief 获取当前的全局重力加速度
@@ -62,12 +138,87 @@ namespace engine::physics
         float getMaxSpeed() const { return max_speed_; }                                                   ///< @brief 获取当前的最大速度
         void setWorldBounds(engine::utils::Rect world_bounds) { world_bounds_ = std::move(world_bounds); } ///< @brief 设置世界边界
         const std::optional<engine::utils::Rect> &getWorldBounds() const { return world_bounds_; }         ///< @brief 获取世界边界
+        void setBroadphaseEnabled(bool enabled) { broadphase_enabled_ = enabled; }                         ///< @brief 设置是否启用空间哈希粗检测
+        bool isBroadphaseEnabled() const { return broadphase_enabled_; }                                   ///< @brief 是否启用空间哈希粗检测
+        void setSleepVelocityThreshold(float threshold) { sleep_velocity_threshold_ = threshold; }         ///< @brief 设置休眠速度阈值
+        float getSleepVelocityThreshold() const { return sleep_velocity_threshold_; }                      ///< @brief 获取休眠速度阈值
+        void setSleepTime(float sleep_time) { sleep_time_ = sleep_time; }                                  ///< @brief 设置进入休眠所需的静止时间
+        float getSleepTime() const { return sleep_time_; }                                                 ///< @brief 获取进入休眠所需的静止时间
+        void setMaxSubsteps(int max_substeps) { max_substeps_ = max_substeps; }                            ///< @brief 设置瓦片碰撞最多拆分的子步数
+        int getMaxSubsteps() const { return max_substeps_; }                                               ///< @brief 获取瓦片碰撞最多拆分的子步数
+        void setSubstepDistance(float distance) { substep_distance_ = distance; }                          ///< @brief 设置触发子步拆分的单步位移阈值
+        float getSubstepDistance() const { return substep_distance_; }                                     ///< @brief 获取触发子步拆分的单步位移阈值
+        void setWorkerThreadCount(size_t count);                                                           ///< @brief 设置并行处理物体的工作线程数（0 表示只使用串行路径）
+        size_t getWorkerThreadCount() const;                                                               ///< @brief 获取工作线程数
+        void setParallelThreshold(size_t threshold) { parallel_threshold_ = threshold; }                   ///< @brief 设置使用并行路径的物体数量阈值
+        size_t getParallelThreshold() const { return parallel_threshold_; }                                ///< @brief 获取使用并行路径的物体数量阈值
+        void setDeterministic(bool deterministic) { deterministic_ = deterministic; }                      ///< @brief 设置是否启用确定性模式
+        bool isDeterministic() const { return deterministic_; }                                            ///< @brief 是否启用确定性模式
+        void setFixedDeltaTime(float delta_time) { fixed_delta_time_ = delta_time; }                       ///< @brief 设置确定性模式下的固定步长（秒）
+        float getFixedDeltaTime() const { return fixed_delta_time_; }                                      ///< @brief 获取确定性模式下的固定步长（秒）
+        void setFixedPointEnabled(bool enabled) { fixed_point_ = enabled; }                                ///< @brief 设置是否把位置和速度量化到定点数网格
+        bool isFixedPointEnabled() const { return fixed_point_; }                                          ///< @brief 是否把位置和速度量化到定点数网格
+        std::uint64_t getStepCount() const { return step_count_; }                                         ///< @brief 获取已模拟的步数
+        /// @brief 获取最近一步结束时的世界状态校验和（仅确定性模式下计算，两次运行在同一步的校验和不同即说明发生了分歧）
+        std::uint64_t getStepChecksum() const { return step_checksum_; }
+
+        // --- 性能统计 ---
+        void setStatsEnabled(bool enabled) { stats_enabled_ = enabled; } ///< @brief 设置是否测量各阶段耗时
+        bool isStatsEnabled() const { return stats_enabled_; }           ///< @brief 是否测量各阶段耗时
+        const PhysicsStats &getStats() const { return stats_; }          ///< @brief 获取最近一步的统计
+        /// @brief 设置统计历史的容量（步数，0 表示不记录），会清空已有记录
+        void setStatsHistorySize(size_t size);
+        size_t getStatsHistorySize() const { return stats_history_size_; } ///< @brief 获取统计历史的容量
+        /**
+         * @brief 按时间顺序（从旧到新）取出统计历史。
+         * @param out 输出容器（会先被清空，调用者可复用以避免分配）。
+         * @return 记录的步数。
+         */
+        size_t getStatsHistory(std::vector<PhysicsStats> &out) const;
+
+        const CollisionGrid &getCollisionGrid() const { return collision_grid_; }    ///< @brief 获取合并后的碰撞网格
+        HeightProfileTable &getHeightProfiles() { return height_profiles_; }         ///< @brief 获取斜坡高度轮廓表（加载瓦片集时注册自定义轮廓）
+        const StaticGeometry &getStaticGeometry() const { return static_geometry_; } ///< @brief 获取合并后的静态碰撞矩形
+
+        // --- 空间查询 (使用最近一次 update 结束时的物体位置，不会修改任何状态) ---
+        /**
+         * @brief 射线检测，返回最近的命中。
+         * 瓦片使用网格 DDA 逐格遍历（SOLID 阻挡；UNISOLID 只阻挡从上方进入的射线；斜坡按表面高度检测），
+         * 对象使用碰撞器的包围盒检测。
+         */
+        RaycastHit raycast(const RaycastQuery &query) const;
+        /**
+         * @brief 盒体投射，返回最近的命中。
+         * 瓦片只检测 SOLID 和 UNISOLID（只阻挡向下移动且起始位于其上方的矩形），使用合并后的静态矩形而非逐格检测；
+         * 对象使用碰撞器的包围盒检测。
+         */
+        RaycastHit boxCast(const BoxCastQuery &query) const;
+        /// @brief 批量射线检测，结果按顺序写入调用者提供的缓冲区（数量取两者较小值，不分配内存）
+        void raycastBatch(std::span<const RaycastQuery> queries, std::span<RaycastHit> results) const;
+        /// @brief 批量盒体投射，结果按顺序写入调用者提供的缓冲区（数量取两者较小值，不分配内存）
+        void boxCastBatch(std::span<const BoxCastQuery> queries, std::span<RaycastHit> results) const;
+        /**
+         * @brief 查询与矩形重叠的对象。
+         * @param aabb 查询矩形（世界坐标）。
+         * @param object_mask 需要检测的对象类别。
+         * @param out 输出容器（会先被清空，调用者可复用以避免分配）。
+         * @param include_triggers 是否包含触发器对象。
+         * @return 重叠的对象数量。
+         */
+        size_t overlapAABB(const engine::utils::Rect &aabb, std::uint32_t object_mask, std::vector<engine::object::GameObject *> &out,
+                           bool include_triggers = false) const;
 
         /// @brief 获取本帧检测到的所有 GameObject 碰撞对。(此列表在每次 update 开始时清空)
-        const std::vector<std::pair<engine::object::GameObject *, engine::object::GameObject *>> &getCollisionPairs() const
+        const std::vector<CollisionPair> &getCollisionPairs() const
         {
             return collision_pairs_;
         };
+        /// @brief 获取本步新开始的接触（上一步不接触、本步接触）。
+        const std::vector<CollisionPair> &getContactEnterEvents() const { return contact_enter_events_; }
+        /// @brief 获取本步仍然保持的接触（上一步和本步都接触）。
+        const std::vector<CollisionPair> &getContactStayEvents() const { return contact_stay_events_; }
+        /// @brief 获取本步结束的接触（上一步接触、本步不接触）。注销物理组件时相关接触会被直接移除，不产生此事件。
+        const std::vector<CollisionPair> &getContactExitEvents() const { return contact_exit_events_; }
         /// @brief 获取本帧检测到的所有瓦片触发事件。(此列表在每次 update 开始时清空)
         const std::vector<std::pair<engine::object::GameObject *, engine::component::TileType>> &getTileTriggerEvents() const
         {
@@ -77,27 +228,80 @@ namespace engine::physics
     private:
         ///< @brief 检测并处理对象之间的碰撞，并记录需要游戏逻辑处理的碰撞对。
         void checkObjectCollisions();
+        void checkObjectCollisionsBruteForce(); ///< @brief 两两遍历所有对象进行碰撞检测
+        void checkObjectCollisionsBroadphase(); ///< @brief 先用空间哈希筛选候选对象，再进行精确碰撞检测
+        void collectActiveColliders();          ///< @brief 收集本次检测中有效的碰撞器到 active_colliders_
+        void updateContacts();                  ///< @brief 对比上一步与本步的接触，生成进入/保持/离开事件
+
+        /**
+         * @brief 对两个对象进行碰撞检测，并处理 SOLID 物体位移或记录碰撞对。
+         * 类别和掩码不匹配的对象会在精确检测之前被直接排除。
+         * @param i 第一个对象的物体下标（i < j）。
+         * @param j 第二个对象的物体下标。
+         * @return 被 SOLID 物体推开的对象索引；没有对象发生位移时返回 std::nullopt。
+         */
+        std::optional<size_t> handleObjectPair(size_t i, size_t j);
+
+        void gatherBodies();                      ///< @brief 从组件读取位置和碰撞盒到物体数组
+        /// @brief 处理 [begin, end) 范围内的物体：应用重力和力、更新速度，再处理瓦片碰撞和世界边界（只写入这些物体自身的数据，可并行调用）
+        void stepBodies(size_t begin, size_t end, float delta_time);
+        void scatterBodies();                     ///< @brief 将物体数组中的位置写回 TransformComponent
+        void updateSleepStates(float delta_time); ///< @brief 让持续静止的动态物体进入休眠
+        std::uint64_t computeChecksum() const;    ///< @brief 计算当前世界状态（物体位置、速度、状态及接触）的校验和
 
         /// @brief 检测并处理游戏对象和瓦片层之间的碰撞。
-        void resolveTileCollisions(engine::component::PhysicsComponent *pc, float delta_time);
+        void resolveTileCollisions(size_t index, float delta_time);
+        /// @brief 根据单步位移决定子步数，多次调用 resolveTileCollisions。
+        void resolveTileCollisionsSubstepped(size_t index, float delta_time);
+
+        /**
+         * @brief 沿单一坐标轴逐格遍历瓦片（一维 DDA），查找第一个阻挡移动的格子。
+         * @param horizontal true 时沿 x 轴遍历列，false 时沿 y 轴遍历行。
+         * @param from 起始格坐标（包含）。
+         * @param to 终止格坐标（包含，即目标位置所在格，同样检查整个覆盖范围）。
+         * @param span_min 另一坐标轴上覆盖的最小格坐标。
+         * @param span_max 另一坐标轴上覆盖的最大格坐标。
+         * @param block_unisolid 是否把 UNISOLID 视为阻挡（仅向下运动时）。
+         * @return 第一个包含阻挡瓦片的格坐标；没有阻挡时返回 std::nullopt。
+         */
+        std::optional<int> sweepTiles(bool horizontal, int from, int to, int span_min, int span_max, bool block_unisolid) const;
 
         /// @brief 处理可移动物体与SOLID物体的碰撞。
-        void resolveSolidObjectCollisions(engine::object::GameObject *move_obj, engine::object::GameObject *solid_obj);
-        void applyWorldBounds(engine::component::PhysicsComponent *pc); ///< @brief 应用世界边界，限制物体移动范围
+        void resolveSolidObjectCollisions(size_t move_index, size_t solid_index);
+        /// @brief 调用 resolveSolidObjectCollisions 并记录次数和耗时。
+        void resolveSolidObjectCollisionsTimed(size_t move_index, size_t solid_index);
+        void applyWorldBounds(size_t index); ///< @brief 应用世界边界，限制物体移动范围
 
         /**
-         * @brief 根据瓦片类型和指定宽度x坐标，计算瓦片上对应y坐标。
+         * @brief 根据瓦片的高度轮廓和指定宽度x坐标，计算瓦片上对应y坐标（查表）。
          * @param width 从瓦片左侧起算的宽度。
-         * @param type 瓦片类型。
-         * @param tile_size 瓦片尺寸。
-         * @return 瓦片上对应高度（从瓦片下侧起算）。
+         * @param tile 瓦片坐标。
+         * @return 瓦片上对应高度（从瓦片下侧起算），非斜坡瓦片为0。
          */
-        float getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tile_size);
+        float getTileHeightAtWidth(float width, glm::ivec2 tile) const;
 
         /**
          * @brief 检测所有游戏对象与瓦片层的触发器类型瓦片碰撞，并记录触发事件。(位移处理完毕后再调用)
          */
         void checkTileTriggers();
+
+        /// @brief 射线与瓦片网格的检测（direction 需已归一化）
+        RaycastHit raycastTiles(glm::vec2 origin, glm::vec2 direction, float max_distance) const;
+        /// @brief 矩形沿方向移动时与瓦片网格的检测（direction 需已归一化）
+        RaycastHit boxCastTiles(const engine::utils::Rect &box, glm::vec2 direction, float max_distance) const;
+        /**
+         * @brief 射线（或矩形，extent 为其尺寸）与对象包围盒的检测，比 best 更近的命中会覆盖 best。
+         * @param origin 射线起点（矩形为左上角）。
+         * @param direction 已归一化的方向。
+         * @param extent 投射矩形的尺寸（射线为0）。
+         */
+        void castObjects(glm::vec2 origin, glm::vec2 direction, float max_distance, glm::vec2 extent, std::uint32_t object_mask,
+                         bool hit_triggers, const engine::object::GameObject *ignore, RaycastHit &best) const;
+        /**
+         * @brief 用最近一次物理步构建的空间哈希查找与矩形可能重叠的物体，结果写入 query_candidates_（按下标升序）。
+         * @return 空间哈希不可用（未启用、已失效或查询范围过大）时返回 false，调用者应退回遍历所有物体。
+         */
+        bool queryBroadphase(const engine::utils::Rect &aabb) const;
     };
 
 } // namespace engine::physics
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+#include "collider.h"
+#include "../utils/math.h"
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::object
+{
+    class GameObject;
+}
+
+namespace engine::component
+{
+    enum class TileType;
+}
+
+namespace engine::physics
+{
+
+    /**
+     * @brief 射线检测参数。
+     */
+    struct RaycastQuery
+    {
+        glm::vec2 origin = {0.0f, 0.0f};                    ///< @brief 射线起点（世界坐标）
+        glm::vec2 direction = {1.0f, 0.0f};                 ///< @brief 射线方向（无需归一化）
+        float max_distance = 0.0f;                          ///< @brief 最大检测距离（像素）
+        std::uint32_t object_mask = category::ALL;          ///< @brief 需要检测的对象类别（NONE 表示不检测对象）
+        bool hit_tiles = true;                              ///< @brief 是否检测瓦片
+        bool hit_triggers = false;                          ///< @brief 是否检测触发器对象
+        const engine::object::GameObject *ignore = nullptr; ///< @brief 忽略的对象（通常是发起检测的对象自身）
+    };
+
+    /**
+     * @brief 盒体投射参数：让矩形沿方向移动，检测第一个阻挡物。
+     */
+    struct BoxCastQuery
+    {
+        engine::utils::Rect box = {{0.0f, 0.0f}, {0.0f, 0.0f}}; ///< @brief 起始矩形（世界坐标）
+        glm::vec2 direction = {1.0f, 0.0f};                     ///< @brief 移动方向（无需归一化）
+        float max_distance = 0.0f;                              ///< @brief 最大移动距离（像素）
+        std::uint32_t object_mask = category::ALL;              ///< @brief 需要检测的对象类别（NONE 表示不检测对象）
+        bool hit_tiles = true;                                  ///< @brief 是否检测瓦片
+        bool hit_triggers = false;                              ///< @brief 是否检测触发器对象
+        const engine::object::GameObject *ignore = nullptr;     ///< @brief 忽略的对象（通常是发起检测的对象自身）
+    };
+
+    /**
+     * @brief 射线检测与盒体投射的结果。
+     */
+    struct RaycastHit
+    {
+        bool hit = false;                             ///< @brief 是否命中
+        float distance = 0.0f;                        ///< @brief 命中时沿方向移动的距离
+        glm::vec2 point = {0.0f, 0.0f};               ///< @brief 命中点（盒体投射为命中时矩形的左上角）
+        glm::vec2 normal = {0.0f, 0.0f};              ///< @brief 命中面的法线
+        engine::component::TileType tile_type{};      ///< @brief 命中的瓦片类型（命中对象时为 EMPTY）
+        engine::object::GameObject *object = nullptr; ///< @brief 命中的对象（命中瓦片时为 nullptr）
+    };
+
+} // namespace engine::physics
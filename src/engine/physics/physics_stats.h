@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::physics
+{
+
+    /**
+     * @brief 单个物理步的性能统计，每次 PhysicsEngine::update 开始时清零。
+     *
+     * 计数总是会统计；各阶段耗时只在启用统计时测量（否则为0）。
+     * 并行路径下积分、瓦片碰撞和世界边界的耗时是各线程耗时之和，而不是实际经过的时间。
+     */
+    struct PhysicsStats
+    {
+        // --- 各阶段耗时 (微秒) ---
+        float integrate_us = 0.0f;     ///< @brief 应用重力和力、更新速度（含运动学物体的移动）
+        float tile_resolve_us = 0.0f;  ///< @brief 瓦片碰撞（含子步）
+        float world_bounds_us = 0.0f;  ///< @brief 世界边界约束
+        float object_pairs_us = 0.0f;  ///< @brief 对象间碰撞检测（粗检测与精确检测，不含 SOLID 推开）
+        float solid_resolve_us = 0.0f; ///< @brief SOLID 物体推开其它物体
+        float tile_triggers_us = 0.0f; ///< @brief 瓦片触发器检测
+        float total_us = 0.0f;         ///< @brief 整个物理步（含读写组件、接触缓存和休眠更新）
+
+        // --- 计数 ---
+        std::uint32_t active_bodies = 0;     ///< @brief 本步参与模拟的物体数（启用、非静态且未休眠）
+        std::uint32_t candidate_pairs = 0;   ///< @brief 粗检测得到的候选对象对
+        std::uint32_t narrowphase_tests = 0; ///< @brief 通过类别掩码筛选、进行了精确检测的对象对
+        std::uint32_t resolved_solids = 0;   ///< @brief 被 SOLID 物体推开的次数
+        std::uint32_t trigger_events = 0;    ///< @brief 瓦片触发事件数
+    };
+
+} // namespace engine::physics
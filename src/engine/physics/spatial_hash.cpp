@@ -0,0 +1,127 @@
+#include "spatial_hash.h"
+#include <algorithm>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics
+{
+
+    void SpatialHash::setCellSize(float cell_size)
+    {
+        if (cell_size <= 0.0f)
+        {
+            spdlog::warn("SpatialHash: 网格单元尺寸 {} 无效，保持为 {}。", cell_size, cell_size_);
+            return;
+        }
+        if (cell_size == cell_size_)
+        {
+            return;
+        }
+        cell_size_ = cell_size;
+        cells_.clear(); // 尺寸变化后旧的网格单元全部失效
+        ranges_.clear();
+        spdlog::trace("SpatialHash: 网格单元尺寸设置为 {}", cell_size_);
+    }
+
+    void SpatialHash::clear()
+    {
+        // 只清空每个单元的内容，不释放单元本身，下一帧可以复用已分配的内存
+        for (auto &[key, ids] : cells_)
+        {
+            ids.clear();
+        }
+        ranges_.clear();
+    }
+
+    void SpatialHash::insert(size_t id, const engine::utils::Rect &aabb)
+    {
+        if (id >= ranges_.size())
+        {
+            ranges_.resize(id + 1);
+        }
+        auto range = computeRange(aabb);
+        for (int y = range.min.y; y <= range.max.y; ++y)
+        {
+            for (int x = range.min.x; x <= range.max.x; ++x)
+            {
+                cells_[makeKey(x, y)].push_back(id);
+            }
+        }
+        ranges_[id] = range;
+    }
+
+    void SpatialHash::update(size_t id, const engine::utils::Rect &aabb)
+    {
+        if (id >= ranges_.size() || !ranges_[id].valid)
+        {
+            insert(id, aabb);
+            return;
+        }
+        auto range = computeRange(aabb);
+        const auto &old_range = ranges_[id];
+        if (range.min == old_range.min && range.max == old_range.max)
+        {
+            return; // 仍在相同的网格单元内，无需更新
+        }
+        remove(id);
+        insert(id, aabb);
+    }
+
+    void SpatialHash::remove(size_t id)
+    {
+        if (id >= ranges_.size() || !ranges_[id].valid)
+        {
+            return;
+        }
+        const auto &range = ranges_[id];
+        for (int y = range.min.y; y <= range.max.y; ++y)
+        {
+            for (int x = range.min.x; x <= range.max.x; ++x)
+            {
+                auto it = cells_.find(makeKey(x, y));
+                if (it == cells_.end())
+                {
+                    continue;
+                }
+                auto &ids = it->second;
+                ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+            }
+        }
+        ranges_[id] = CellRange{};
+    }
+
+    void SpatialHash::query(const engine::utils::Rect &aabb, std::vector<size_t> &out) const
+    {
+        out.clear();
+        auto range = computeRange(aabb);
+        for (int y = range.min.y; y <= range.max.y; ++y)
+        {
+            for (int x = range.min.x; x <= range.max.x; ++x)
+            {
+                auto it = cells_.find(makeKey(x, y));
+                if (it != cells_.end())
+                {
+                    out.insert(out.end(), it->second.begin(), it->second.end());
+                }
+            }
+        }
+        // 跨越多个单元的物体会被重复收集，排序去重后按 id 升序返回
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    SpatialHash::CellRange SpatialHash::computeRange(const engine::utils::Rect &aabb) const
+    {
+        // 取两端的较小/较大值，兼容负缩放导致的负尺寸
+        auto p0 = aabb.position;
+        auto p1 = aabb.position + aabb.size;
+        CellRange range;
+        range.min = {static_cast<int>(std::floor(std::min(p0.x, p1.x) / cell_size_)),
+                     static_cast<int>(std::floor(std::min(p0.y, p1.y) / cell_size_))};
+        range.max = {static_cast<int>(std::floor(std::max(p0.x, p1.x) / cell_size_)),
+                     static_cast<int>(std::floor(std::max(p0.y, p1.y) / cell_size_))};
+        range.valid = true;
+        return range;
+    }
+
+} // namespace engine::physics
@@ -0,0 +1,58 @@
+#pragma once
+#include "../utils/math.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine::physics
+{
+
+    /**
+     * @brief 均匀网格空间哈希，用于对象碰撞的粗检测（broadphase）。
+     *
+     * 每个物体以整数 id 插入，并按其 AABB 覆盖的所有网格单元登记。
+     * 查询时只返回与给定矩形处于相同网格单元的物体，从而避免两两遍历所有物体。
+     */
+    class SpatialHash final
+    {
+    private:
+        /// @brief 物体当前覆盖的网格单元范围（闭区间）
+        struct CellRange
+        {
+            glm::ivec2 min = {0, 0};
+            glm::ivec2 max = {-1, -1};
+            bool valid = false;
+        };
+
+        float cell_size_ = 64.0f;                                     ///< @brief 网格单元边长（像素）
+        std::unordered_map<std::int64_t, std::vector<size_t>> cells_; ///< @brief 网格单元 -> 物体 id 列表（清空时保留容量，避免每帧重新分配）
+        std::vector<CellRange> ranges_;                               ///< @brief 物体 id -> 覆盖的网格单元范围
+
+    public:
+        SpatialHash() = default;
+
+        void setCellSize(float cell_size);               ///< @brief 设置网格单元边长（会清空所有数据）
+        float getCellSize() const { return cell_size_; } ///< @brief 获取网格单元边长
+
+        void clear();                                            ///< @brief 清空所有物体（保留已分配的网格单元内存）
+        void insert(size_t id, const engine::utils::Rect &aabb); ///< @brief 插入物体
+        void update(size_t id, const engine::utils::Rect &aabb); ///< @brief 更新物体位置（覆盖范围不变时不做任何操作）
+        void remove(size_t id);                                  ///< @brief 移除物体
+
+        /**
+         * @brief 查询与矩形处于相同网格单元的所有物体。
+         * @param aabb 查询矩形。
+         * @param out 输出容器（会先被清空），结果按 id 升序排列且不重复。
+         */
+        void query(const engine::utils::Rect &aabb, std::vector<size_t> &out) const;
+
+    private:
+        CellRange computeRange(const engine::utils::Rect &aabb) const; ///< @brief 计算矩形覆盖的网格单元范围
+        static std::int64_t makeKey(int x, int y)                      ///< @brief 将网格坐标打包为哈希键
+        {
+            return (static_cast<std::int64_t>(x) << 32) | static_cast<std::uint32_t>(y);
+        }
+    };
+
+} // namespace engine::physics
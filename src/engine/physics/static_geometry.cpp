@@ -0,0 +1,114 @@
+#include "static_geometry.h"
+#include "collision_grid.h"
+#include "../component/tilelayer_component.h"
+#include <spdlog/spdlog.h>
+#include <glm/common.hpp>
+
+namespace engine::physics
+{
+
+    void StaticGeometry::rebuild(const CollisionGrid &grid)
+    {
+        clear();
+        if (grid.empty())
+        {
+            return;
+        }
+        tile_size_ = grid.getTileSize();
+        auto map_size = grid.getMapSize();
+        auto tile_size = glm::vec2(tile_size_);
+        auto addBox = [this, tile_size](glm::ivec2 tile_min, glm::ivec2 tile_max, engine::component::TileType type)
+        {
+            auto position = glm::vec2(tile_min) * tile_size;
+            boxes_.push_back({tile_min, tile_max, {position, glm::vec2(tile_max - tile_min) * tile_size}, type});
+        };
+
+        // 已被某个 SOLID 矩形覆盖的格子
+        std::vector<bool> used(static_cast<size_t>(map_size.x) * map_size.y, false);
+        auto isFreeSolid = [&](int x, int y)
+        {
+            return !used[static_cast<size_t>(y) * map_size.x + x] &&
+                   grid.getTileTypeAt({x, y}) == engine::component::TileType::SOLID;
+        };
+
+        for (int y = 0; y < map_size.y; ++y)
+        {
+            for (int x = 0; x < map_size.x; ++x)
+            {
+                auto type = grid.getTileTypeAt({x, y});
+                if (type == engine::component::TileType::UNISOLID)
+                {
+                    // 单向平台只沿行合并
+                    auto begin = x;
+                    while (x + 1 < map_size.x && grid.getTileTypeAt({x + 1, y}) == engine::component::TileType::UNISOLID)
+                        ++x;
+                    addBox({begin, y}, {x + 1, y + 1}, type);
+                    continue;
+                }
+                if (!isFreeSolid(x, y))
+                    continue;
+                // 先向右延伸得到宽度，再逐行向下延伸（整行宽度都是未使用的 SOLID 才延伸）
+                auto x_end = x + 1;
+                while (x_end < map_size.x && isFreeSolid(x_end, y))
+                    ++x_end;
+                auto y_end = y + 1;
+                while (y_end < map_size.y)
+                {
+                    auto full_row = true;
+                    for (int cx = x; cx < x_end && full_row; ++cx)
+                        full_row = isFreeSolid(cx, y_end);
+                    if (!full_row)
+                        break;
+                    ++y_end;
+                }
+                for (int cy = y; cy < y_end; ++cy)
+                    std::fill_n(used.begin() + static_cast<std::ptrdiff_t>(cy) * map_size.x + x, x_end - x, true);
+                addBox({x, y}, {x_end, y_end}, type);
+                x = x_end - 1;
+            }
+        }
+        buildBuckets(map_size);
+        spdlog::trace("静态碰撞几何合并完成，矩形数量: {}", boxes_.size());
+    }
+
+    void StaticGeometry::clear()
+    {
+        boxes_.clear();
+        tile_size_ = {0, 0};
+        bucket_count_ = {0, 0};
+        bucket_offsets_.assign(1, 0);
+        bucket_boxes_.clear();
+    }
+
+    void StaticGeometry::buildBuckets(glm::ivec2 map_size)
+    {
+        bucket_count_ = (map_size + BUCKET_TILES - 1) / BUCKET_TILES;
+        auto bucket_total = static_cast<size_t>(bucket_count_.x) * bucket_count_.y;
+        // 计数排序：先统计每个桶的矩形数，再按前缀和填入
+        bucket_offsets_.assign(bucket_total + 1, 0);
+        for (const auto &box : boxes_)
+        {
+            auto first = floorDiv(box.tile_min, BUCKET_TILES);
+            auto last = floorDiv(box.tile_max - 1, BUCKET_TILES);
+            for (int by = first.y; by <= last.y; ++by)
+                for (int bx = first.x; bx <= last.x; ++bx)
+                    ++bucket_offsets_[static_cast<size_t>(by) * bucket_count_.x + bx + 1];
+        }
+        for (size_t i = 1; i <= bucket_total; ++i)
+        {
+            bucket_offsets_[i] += bucket_offsets_[i - 1];
+        }
+        bucket_boxes_.resize(bucket_offsets_.back());
+        std::vector<size_t> cursor(bucket_offsets_.begin(), bucket_offsets_.end() - 1);
+        for (size_t index = 0; index < boxes_.size(); ++index)
+        {
+            const auto &box = boxes_[index];
+            auto first = floorDiv(box.tile_min, BUCKET_TILES);
+            auto last = floorDiv(box.tile_max - 1, BUCKET_TILES);
+            for (int by = first.y; by <= last.y; ++by)
+                for (int bx = first.x; bx <= last.x; ++bx)
+                    bucket_boxes_[cursor[static_cast<size_t>(by) * bucket_count_.x + bx]++] = static_cast<std::uint32_t>(index);
+        }
+    }
+
+} // namespace engine::physics
@@ -0,0 +1,99 @@
+#pragma once
+#include "../utils/math.h"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::component
+{
+    enum class TileType;
+}
+
+namespace engine::physics
+{
+    class CollisionGrid;
+
+    /**
+     * @brief 由碰撞网格中的 SOLID / UNISOLID 瓦片贪心合并得到的静态矩形集合。
+     *
+     * SOLID 瓦片先沿行合并为横向区间，再把宽度相同的相邻行区间向下延伸，得到尽量少的矩形；
+     * UNISOLID 只阻挡从上方进入的物体，叠在一起的平台各自都有顶面，因此只沿行合并。
+     * 矩形按粗粒度的桶网格索引（每个桶覆盖 BUCKET_TILES x BUCKET_TILES 个瓦片），
+     * 大范围的查询只需检测少量矩形，而不是逐格遍历。
+     */
+    class StaticGeometry final
+    {
+    public:
+        static constexpr int BUCKET_TILES = 8; ///< @brief 每个索引桶覆盖的瓦片数（每个方向）
+
+        /// @brief 合并后的矩形
+        struct Box
+        {
+            glm::ivec2 tile_min = {0, 0};       ///< @brief 起始瓦片坐标（包含）
+            glm::ivec2 tile_max = {0, 0};       ///< @brief 终止瓦片坐标（不包含）
+            engine::utils::Rect rect = {};      ///< @brief 世界坐标矩形（像素）
+            engine::component::TileType type{}; ///< @brief 瓦片类型（SOLID 或 UNISOLID）
+        };
+
+    private:
+        std::vector<Box> boxes_;                  ///< @brief 所有矩形
+        glm::ivec2 tile_size_ = {0, 0};           ///< @brief 单个瓦片尺寸（像素）
+        glm::ivec2 bucket_count_ = {0, 0};        ///< @brief 桶网格尺寸
+        std::vector<size_t> bucket_offsets_;      ///< @brief 第 i 个桶的矩形为 bucket_boxes_[offsets[i], offsets[i + 1])
+        std::vector<std::uint32_t> bucket_boxes_; ///< @brief 按桶分组的矩形下标
+
+    public:
+        StaticGeometry() { clear(); }
+
+        /// @brief 根据碰撞网格重新合并矩形并建立索引
+        void rebuild(const CollisionGrid &grid);
+        void clear(); ///< @brief 清空所有矩形
+
+        const std::vector<Box> &getBoxes() const { return boxes_; } ///< @brief 获取所有矩形
+        bool empty() const { return boxes_.empty(); }               ///< @brief 是否没有任何矩形
+
+        /**
+         * @brief 对与瓦片矩形范围重叠的每个矩形调用一次 func，不分配内存。
+         * @param start 范围起点瓦片坐标（包含）
+         * @param end 范围终点瓦片坐标（包含）
+         * @param func 以 const Box & 为参数的可调用对象
+         */
+        template <typename Func>
+        void forEachOverlapping(glm::ivec2 start, glm::ivec2 end, Func &&func) const
+        {
+            if (boxes_.empty())
+                return;
+            auto bucket_start = glm::max(floorDiv(start, BUCKET_TILES), glm::ivec2(0));
+            auto bucket_end = glm::min(floorDiv(end, BUCKET_TILES), bucket_count_ - 1);
+            for (int by = bucket_start.y; by <= bucket_end.y; ++by)
+            {
+                for (int bx = bucket_start.x; bx <= bucket_end.x; ++bx)
+                {
+                    auto bucket = static_cast<size_t>(by) * bucket_count_.x + bx;
+                    for (auto i = bucket_offsets_[bucket]; i < bucket_offsets_[bucket + 1]; ++i)
+                    {
+                        const auto &box = boxes_[bucket_boxes_[i]];
+                        if (box.tile_max.x <= start.x || box.tile_min.x > end.x || box.tile_max.y <= start.y || box.tile_min.y > end.y)
+                            continue;
+                        // 跨越多个桶的矩形只在查询范围内它所覆盖的第一个桶中报告，避免重复
+                        auto first_bucket = glm::max(floorDiv(box.tile_min, BUCKET_TILES), bucket_start);
+                        if (first_bucket.x != bx || first_bucket.y != by)
+                            continue;
+                        func(box);
+                    }
+                }
+            }
+        }
+
+    private:
+        /// @brief 向下取整的整数除法（支持负数）
+        static glm::ivec2 floorDiv(glm::ivec2 value, int divisor)
+        {
+            return {value.x >= 0 ? value.x / divisor : -((-value.x + divisor - 1) / divisor),
+                    value.y >= 0 ? value.y / divisor : -((-value.y + divisor - 1) / divisor)};
+        }
+        void buildBuckets(glm::ivec2 map_size); ///< @brief 根据矩形建立桶索引
+    };
+
+} // namespace engine::physics
@@ -5,7 +5,7 @@
 
 namespace engine::render
 {
-    Camera::Camera(glm::vec2 viewport_size, glm::vec2 position, std::optional<engine::utils::Rect> limit_bounds) : viewport_size_(viewport_size), position_(position), limit_bounds_(limit_bounds)
+    Camera::Camera(glm::vec2 viewport_size, glm::vec2 position, std::optional<engine::utils::Rect> limit_bounds) : viewport_size_(viewport_size), position_(position), limit_bounds_(limit_bounds), previous_position_(position)
     {
         spdlog::trace("相机初始化成功，位置{},{}", position_.x, position_.y);
     }
@@ -49,23 +49,24 @@ namespace engine::render
     // translation
     glm::vec2 Camera::worldToScreen(const glm::vec2 &world_pos) const
     {
-        return world_pos - position_;
+        return world_pos - getRenderPosition();
     }
 
     glm::vec2 Camera::worldToScreenWithParallax(const glm::vec2 &world_pos, const glm::vec2 &scroll_factor) const
     {
-        return world_pos - position_ * scroll_factor;
+        return world_pos - getRenderPosition() * scroll_factor;
     }
 
     glm::vec2 Camera::screenToWorld(const glm::vec2 &screen_pos) const
     {
-        return screen_pos + position_;
+        return screen_pos + getRenderPosition();
     }
 
     // getter setter
     void Camera::setPosition(glm::vec2 position)
     {
         position_ = position;
+        previous_position_ = position; // 直接设置位置视为瞬移，不做插值
     }
 
     void Camera::setLimitBounds(std::optional<engine::utils::Rect> limit_bounds)
@@ -79,6 +80,16 @@ namespace engine::render
         target_ = target;
     }
 
+    void Camera::setInterpolationAlpha(float alpha)
+    {
+        interpolation_alpha_ = glm::clamp(alpha, 0.0f, 1.0f);
+    }
+
+    void Camera::storePreviousPosition()
+    {
+        previous_position_ = position_;
+    }
+
     const glm::vec2 &Camera::getPosition() const
     {
         return position_;
@@ -99,6 +110,21 @@ namespace engine::render
         return target_;
     }
 
+    float Camera::getInterpolationAlpha() const
+    {
+        return interpolation_alpha_;
+    }
+
+    glm::vec2 Camera::getRenderPosition() const
+    {
+        if (interpolation_alpha_ >= 1.0f)
+        {
+            return position_;
+        }
+        auto position = glm::mix(previous_position_, position_, interpolation_alpha_);
+        return glm::vec2(glm::round(position.x), glm::round(position.y)); // 同 update，取整避免画面割裂
+    }
+
     void Camera::clampPosition()
     {
         // 边界检查需要确保相机视图在limit_bounds内
@@ -17,6 +17,8 @@ namespace engine::render
         std::optional<engine::utils::Rect> limit_bounds_;         // 限制相机移动范围，无值表示不限制
         float smooth_speed_ = 5.0f;                               // 相机平滑移动
         engine::component::TransformComponent *target_ = nullptr; // 相机跟随目标
+        glm::vec2 previous_position_;                             // 上一个固定步开始时的位置（用于渲染插值）
+        float interpolation_alpha_ = 1.0f;                        // 渲染插值因子，1 表示直接使用当前位置
 
     public:
         Camera(glm::vec2 viewport_size, glm::vec2 position = glm::vec2(0.0f, 0.0f), std::optional<engine::utils::Rect> limit_bounds = std::nullopt);
@@ -31,11 +33,15 @@ namespace engine::render
         void setPosition(glm::vec2 position);                                 // 设置相机位置
         void setLimitBounds(std::optional<engine::utils::Rect> limit_bounds); // 设置限制相机的移动范围
         void setTarget(engine::component::TransformComponent *target);        // 设置跟随目标变化组件
+        void setInterpolationAlpha(float alpha);                              // 设置渲染插值因子（由主循环在每帧渲染前设置）
+        void storePreviousPosition();                                         // 记录当前位置作为插值的上一状态（每个固定步开始时调用）
 
         const glm::vec2 &getPosition() const;                      // 获取相机位置
         std::optional<engine::utils::Rect> getLimitBounds() const; // 获取限制相机的移动范围
         glm::vec2 getViewportSize() const;                         // 获取视口大小
         engine::component::TransformComponent *getTarget() const;  // 获取跟随目标变化组件
+        float getInterpolationAlpha() const;                       // 获取渲染插值因子
+        glm::vec2 getRenderPosition() const;                       // 获取插值后的渲染位置
 
         // 禁用拷贝和移动语义
         Camera(const Camera &) = delete;
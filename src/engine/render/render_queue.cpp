@@ -0,0 +1,81 @@
+#include "render_queue.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace engine::render
+{
+    void RenderQueue::submit(int layer, const DrawItem &item)
+    {
+        // 各字段钳制到16位；深度加上偏移，使视口上方的负坐标也能正确排序
+        auto layer_key = static_cast<std::uint64_t>(std::clamp(layer, 0, 0xFFFF));
+        auto texture_key = static_cast<std::uint64_t>(getTextureId(item.texture));
+        auto bottom = std::floor(item.dest_rect.y + item.dest_rect.h) + 32768.0f;
+        auto depth_key = static_cast<std::uint64_t>(std::clamp(bottom, 0.0f, 65535.0f));
+
+        entries_.push_back({(layer_key << 32) | (texture_key << 16) | depth_key, static_cast<std::uint32_t>(items_.size())});
+        items_.push_back(item);
+    }
+
+    void RenderQueue::sort()
+    {
+        if (entries_.size() < 2)
+        {
+            return;
+        }
+        // LSD 基数排序：每次按一个字节分配，先统计所有字节的直方图，只需遍历一次键
+        std::array<std::array<size_t, 256>, KEY_BYTES> counts{};
+        for (const auto &entry : entries_)
+        {
+            for (int byte = 0; byte < KEY_BYTES; ++byte)
+            {
+                ++counts[byte][(entry.key >> (byte * 8)) & 0xFF];
+            }
+        }
+
+        scratch_.resize(entries_.size());
+        for (int byte = 0; byte < KEY_BYTES; ++byte)
+        {
+            auto &count = counts[byte];
+            // 所有键在这个字节上都相同时跳过（例如只有一个渲染层）
+            if (std::find(count.begin(), count.end(), entries_.size()) != count.end())
+            {
+                continue;
+            }
+            size_t offset = 0;
+            for (auto &c : count)
+            {
+                auto n = c;
+                c = offset;
+                offset += n;
+            }
+            for (const auto &entry : entries_)
+            {
+                scratch_[count[(entry.key >> (byte * 8)) & 0xFF]++] = entry;
+            }
+            entries_.swap(scratch_);
+        }
+    }
+
+    void RenderQueue::clear()
+    {
+        items_.clear();
+        entries_.clear();
+        texture_ids_.clear();
+        last_texture_ = nullptr;
+        last_texture_id_ = 0;
+    }
+
+    std::uint16_t RenderQueue::getTextureId(SDL_Texture *texture)
+    {
+        if (texture != last_texture_ || texture_ids_.empty())
+        {
+            // 超过16位能表示的纹理数时共用最后一个序号（只影响合批，不影响正确性）
+            auto next_id = static_cast<std::uint16_t>(std::min<size_t>(texture_ids_.size(), 0xFFFF));
+            last_texture_id_ = texture_ids_.try_emplace(texture, next_id).first->second;
+            last_texture_ = texture;
+        }
+        return last_texture_id_;
+    }
+
+} // namespace engine::render
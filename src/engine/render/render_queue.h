@@ -0,0 +1,70 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <SDL3/SDL_render.h>
+
+namespace engine::render
+{
+    /**
+     * @brief 一帧内世界绘制的排序队列。
+     *
+     * 绘制请求（已转换到屏幕坐标的纹理四边形）先连同排序键一起收集起来，每帧用基数排序排序一次后再提交，
+     * 绘制顺序不再依赖游戏对象在场景中的存放顺序。排序键从高到低依次为：
+     * 渲染层（Tiled 图层序号）、纹理（本帧内首次出现的先后）、深度（目标矩形底边的屏幕 y 坐标）。
+     * 同一层内相同纹理的绘制排在一起，可以合并为一个批次；基数排序是稳定的，键相同时保持提交顺序。
+     */
+    class RenderQueue final
+    {
+    public:
+        struct DrawItem
+        {
+            SDL_Texture *texture = nullptr; // 纹理
+            SDL_FRect src_rect = {};        // 源矩形
+            SDL_FRect dest_rect = {};       // 目标矩形（屏幕坐标）
+            float angle = 0.0f;             // 绕目标矩形中心顺时针旋转的角度
+            bool flipped = false;           // 是否水平翻转
+        };
+
+    private:
+        static constexpr int KEY_BYTES = 6; // 排序键的有效字节数（层、纹理、深度各16位）
+
+        struct SortEntry
+        {
+            std::uint64_t key = 0;   // 排序键
+            std::uint32_t index = 0; // 对应 items_ 的下标
+        };
+
+        std::vector<DrawItem> items_;                                  // 本帧提交的绘制请求（按提交顺序）
+        std::vector<SortEntry> entries_;                               // 排序键（排序后按绘制顺序排列）
+        std::vector<SortEntry> scratch_;                               // 基数排序的临时缓冲区
+        std::unordered_map<SDL_Texture *, std::uint16_t> texture_ids_; // 本帧内纹理 → 纹理序号
+        SDL_Texture *last_texture_ = nullptr;                          // 上一次提交的纹理（连续提交同一纹理时省去查找）
+        std::uint16_t last_texture_id_ = 0;                            // 上一次提交的纹理序号
+
+    public:
+        RenderQueue() = default;
+
+        // 提交一个绘制请求，layer 为渲染层（越大越靠上）
+        void submit(int layer, const DrawItem &item);
+        void sort();  // 按排序键排序（每帧一次）
+        void clear(); // 清空队列（保留容量，下一帧复用）
+
+        bool empty() const { return items_.empty(); } // 队列是否为空
+        size_t size() const { return items_.size(); } // 绘制请求数量
+
+        // 按排序后的顺序对每个绘制请求调用一次 func（需先调用 sort）
+        template <typename Func>
+        void forEachSorted(Func &&func) const
+        {
+            for (const auto &entry : entries_)
+            {
+                func(items_[entry.index]);
+            }
+        }
+
+    private:
+        std::uint16_t getTextureId(SDL_Texture *texture); // 获取纹理在本帧内的序号（首次出现时分配）
+    };
+
+} // namespace engine::render
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::render
+{
+
+    /**
+     * @brief 单帧的渲染统计，每次 Renderer::clearScreen 时清零（清零前保存为上一帧的统计）。
+     *
+     * 精灵计数以四边形为单位：视差图层每个重复单元、每个瓦片区块都算一个。
+     * 文字通过 SDL_ttf 直接绘制，不计入 draw_calls，单独记录在 text_* 中（TextRenderer 没有关联 Renderer 时不统计）。
+     */
+    struct RenderStats
+    {
+        std::uint32_t draw_calls = 0;           ///< @brief 提交给 SDL_Renderer 的绘制调用（几何批次和填充矩形）
+        std::uint32_t sprites_submitted = 0;    ///< @brief 通过视口裁剪、进入渲染队列或批次的四边形
+        std::uint32_t sprites_culled = 0;       ///< @brief 被 isRectInViewport 裁剪掉的四边形
+        std::uint32_t texture_switches = 0;     ///< @brief 批次纹理切换次数
+        std::uint32_t vertices = 0;             ///< @brief 提交的顶点数
+        std::uint32_t text_objects_created = 0; ///< @brief 创建的临时 TTF_Text 对象数
+        std::uint32_t text_draw_calls = 0;      ///< @brief TTF_DrawRendererText 调用次数（含阴影）
+    };
+
+} // namespace engine::render
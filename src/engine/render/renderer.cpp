@@ -4,6 +4,8 @@
 #include "sprite.h"
 #include <SDL3/SDL.h>
 #include <stdexcept> // For std::runtime_error
+#include <cmath>
+#include <numbers>
 #include <spdlog/spdlog.h>
 
 namespace engine::render
@@ -22,6 +24,8 @@ namespace engine::render
         }
 
         setDrawColor(0, 0, 0, 255);
+        batch_vertices_.reserve(MAX_BATCH_QUADS * 4);
+        batch_indices_.reserve(MAX_BATCH_QUADS * 6);
         spdlog::trace("Renderer构造成功");
     }
 
@@ -31,14 +35,14 @@ namespace engine::render
                               const glm::vec2 &scale,
                               double angle)
     {
-        auto texture = resource_manager_->getTexture(sprite.getTextureId());
+        auto texture = resolveTexture(sprite);
         if (!texture)
         {
             spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
             return;
         }
 
-        auto src_rect = getSpriteSrcRect(sprite);
+        auto src_rect = getSpriteSrcRect(sprite, texture);
         if (!src_rect.has_value())
         {
             spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
@@ -61,14 +65,12 @@ namespace engine::render
         {
             // 视口裁剪：如果精灵超出视口，则不绘制
             // spdlog::info("精灵超出视口范围，ID: {}", sprite.getTextureId());
+            ++stats_.sprites_culled;
             return;
         }
 
-        // 执行绘制(默认旋转中心为精灵的中心点)
-        if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, angle, NULL, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE))
-        {
-            spdlog::error("渲染旋转纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
-        }
+        // 提交到排序队列(旋转中心为精灵的中心点)
+        submitQuad(texture, src_rect.value(), dest_rect, angle, sprite.isFlipped());
     }
 
     void Renderer::drawParallax(const Camera &camera,
@@ -77,62 +79,82 @@ namespace engine::render
                                 const glm::bvec2 &repeat,
                                 const glm::vec2 &scale)
     {
-        auto texture = resource_manager_->getTexture(sprite.getTextureId());
+        auto texture = resolveTexture(sprite);
         if (!texture)
         {
             spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
             return;
         }
 
-        auto src_rect = getSpriteSrcRect(sprite);
+        auto src_rect = getSpriteSrcRect(sprite, texture);
         if (!src_rect.has_value())
         {
             spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
             return;
         }
 
+        // 每个重复单元绘制整张纹理，尺寸为（源矩形尺寸 × 缩放）
+        auto scaled_size = glm::vec2(src_rect.value().w * scale.x, src_rect.value().h * scale.y);
+        drawParallaxTexture(camera, texture, position, scroll_factor, repeat, scaled_size);
+    }
+
+    void Renderer::drawParallaxTexture(const Camera &camera,
+                                       SDL_Texture *texture,
+                                       const glm::vec2 &position,
+                                       const glm::vec2 &scroll_factor,
+                                       const glm::bvec2 &repeat,
+                                       const glm::vec2 &tile_size)
+    {
+        if (!texture || tile_size.x <= 0.0f || tile_size.y <= 0.0f)
+        {
+            return;
+        }
+
         // 应用相机变换
         glm::vec2 position_screen = camera.worldToScreenWithParallax(position, scroll_factor);
 
-        // 计算缩放后的纹理尺寸
-        float scaled_tex_w = src_rect.value().w * scale.x;
-        float scaled_tex_h = src_rect.value().h * scale.y;
-
         glm::vec2 start, stop;
         glm::vec2 viewport_size = camera.getViewportSize();
 
         if (repeat.x)
         {
-            // 使用 glm::mod 进行浮点数取模
-            start.x = glm::mod(position_screen.x, scaled_tex_w) - scaled_tex_w;
+            // 使用 glm::mod 进行浮点数取模，起点落在 (-tile_size.x, 0] 内，不绘制完全位于视口左侧的单元
+            start.x = glm::mod(position_screen.x, tile_size.x);
+            if (start.x > 0.0f)
+            {
+                start.x -= tile_size.x;
+            }
             stop.x = viewport_size.x;
         }
         else
         {
             start.x = position_screen.x;
-            stop.x = glm::min(position_screen.x + scaled_tex_w, viewport_size.x); // 结束点是一个纹理宽度之后，但不超过视口宽度
+            stop.x = glm::min(position_screen.x + tile_size.x, viewport_size.x); // 结束点是一个纹理宽度之后，但不超过视口宽度
         }
         if (repeat.y)
         {
-            start.y = glm::mod(position_screen.y, scaled_tex_h) - scaled_tex_h;
+            start.y = glm::mod(position_screen.y, tile_size.y);
+            if (start.y > 0.0f)
+            {
+                start.y -= tile_size.y;
+            }
             stop.y = viewport_size.y;
         }
         else
         {
             start.y = position_screen.y;
-            stop.y = glm::min(position_screen.y + scaled_tex_h, viewport_size.y); // 结束点是一个纹理高度之后，但不超过视口高度
+            stop.y = glm::min(position_screen.y + tile_size.y, viewport_size.y); // 结束点是一个纹理高度之后，但不超过视口高度
         }
 
-        for (float y = start.y; y < stop.y; y += scaled_tex_h)
+        // 每个重复的单元都绘制整张纹理
+        SDL_FRect full_rect = {0.0f, 0.0f, 0.0f, 0.0f};
+        SDL_GetTextureSize(texture, &full_rect.w, &full_rect.h);
+        for (float y = start.y; y < stop.y; y += tile_size.y)
         {
-            for (float x = start.x; x < stop.x; x += scaled_tex_w)
+            for (float x = start.x; x < stop.x; x += tile_size.x)
             {
-                SDL_FRect dest_rect = {x, y, scaled_tex_w, scaled_tex_h};
-                if (!SDL_RenderTexture(renderer_, texture, nullptr, &dest_rect))
-                {
-                    spdlog::error("渲染视差纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
-                    return;
-                }
+                SDL_FRect dest_rect = {x, y, tile_size.x, tile_size.y};
+                submitQuad(texture, full_rect, dest_rect);
             }
         }
     }
@@ -141,14 +163,14 @@ namespace engine::render
                                 const glm::vec2 &position,
                                 const std::optional<glm::vec2> &size)
     {
-        auto texture = resource_manager_->getTexture(sprite.getTextureId());
+        auto texture = resolveTexture(sprite);
         if (!texture)
         {
             spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
             return;
         }
 
-        auto src_rect = getSpriteSrcRect(sprite);
+        auto src_rect = getSpriteSrcRect(sprite, texture);
         if (!src_rect.has_value())
         {
             spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
@@ -167,17 +189,21 @@ namespace engine::render
             dest_rect.h = src_rect.value().h;
         }
 
-        // 执行绘制(未考虑UI旋转)
-        if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, 0.0, nullptr, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE))
+        // UI 绘制在所有世界绘制之上：先提交排序队列，再加入批次(未考虑UI旋转)
+        if (!rendering_to_texture_)
         {
-            spdlog::error("渲染 UI Sprite 失败 (ID: {}): {}", sprite.getTextureId(), SDL_GetError());
+            submitQueue();
         }
+        ++stats_.sprites_submitted;
+        queueQuad(texture, src_rect.value(), dest_rect, 0.0, sprite.isFlipped());
     }
 
     void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color)
     {
+        flush(); // 填充矩形不经过批次，先提交之前的绘制以保持顺序
         setDrawColorFloat(color.r, color.g, color.b, color.a);
         SDL_FRect sdl_rect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
+        ++stats_.draw_calls;
         if (!SDL_RenderFillRect(renderer_, &sdl_rect))
         {
             spdlog::error("绘制填充矩形失败：{}", SDL_GetError());
@@ -185,17 +211,204 @@ namespace engine::render
         setDrawColor(0, 0, 0, 1.0f);
     }
 
+    void Renderer::drawTexture(const Camera &camera, SDL_Texture *texture, const glm::vec2 &position, const glm::vec2 &size)
+    {
+        glm::vec2 position_screen = camera.worldToScreen(position);
+        SDL_FRect dest_rect = {position_screen.x, position_screen.y, size.x, size.y};
+        if (!isRectInViewport(camera, dest_rect))
+        {
+            ++stats_.sprites_culled;
+            return;
+        }
+        SDL_FRect src_rect = {0.0f, 0.0f, 0.0f, 0.0f};
+        SDL_GetTextureSize(texture, &src_rect.w, &src_rect.h);
+        submitQuad(texture, src_rect, dest_rect);
+    }
+
+    SDL_Texture *Renderer::createTargetTexture(const glm::ivec2 &size)
+    {
+        SDL_Texture *texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, size.x, size.y);
+        if (!texture)
+        {
+            spdlog::error("创建渲染目标纹理失败 ({}x{})：{}", size.x, size.y, SDL_GetError());
+            return nullptr;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST); // 与普通纹理一致，保持像素风格
+        return texture;
+    }
+
+    bool Renderer::beginRenderToTexture(SDL_Texture *target)
+    {
+        flushBatch(); // 排序队列中的世界绘制仍属于窗口，留到之后提交
+        if (!SDL_SetRenderTarget(renderer_, target))
+        {
+            spdlog::error("切换渲染目标失败：{}", SDL_GetError());
+            return false;
+        }
+        rendering_to_texture_ = true;
+        // 清空为完全透明，再恢复原来的绘制颜色
+        Uint8 r, g, b, a;
+        SDL_GetRenderDrawColor(renderer_, &r, &g, &b, &a);
+        SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 0);
+        SDL_RenderClear(renderer_);
+        SDL_SetRenderDrawColor(renderer_, r, g, b, a);
+        return true;
+    }
+
+    void Renderer::endRenderToTexture()
+    {
+        flushBatch();
+        rendering_to_texture_ = false;
+        if (!SDL_SetRenderTarget(renderer_, nullptr))
+        {
+            spdlog::error("恢复渲染目标失败：{}", SDL_GetError());
+        }
+    }
+
     void Renderer::present()
     {
+        flush();
         SDL_RenderPresent(renderer_);
     }
 
     void Renderer::clearScreen()
     {
+        flush();
         if (!SDL_RenderClear(renderer_))
         {
             spdlog::error("清除渲染器失败：{}", SDL_GetError());
         }
+
+        // 结束上一帧的统计
+        last_frame_stats_ = stats_;
+        stats_ = RenderStats{};
+        ++frame_index_;
+        if (stats_log_interval_ > 0 && frame_index_ % static_cast<std::uint64_t>(stats_log_interval_) == 0)
+        {
+            const auto &stats = last_frame_stats_;
+            spdlog::info("渲染统计（第 {} 帧）：绘制调用 {}，精灵 {}（裁剪 {}），纹理切换 {}，顶点 {}，文字对象 {}（绘制 {}）",
+                         frame_index_, stats.draw_calls, stats.sprites_submitted, stats.sprites_culled, stats.texture_switches,
+                         stats.vertices, stats.text_objects_created, stats.text_draw_calls);
+        }
+    }
+
+    void Renderer::addTextStats(std::uint32_t objects_created, std::uint32_t draw_calls)
+    {
+        stats_.text_objects_created += objects_created;
+        stats_.text_draw_calls += draw_calls;
+    }
+
+    void Renderer::flush()
+    {
+        if (!rendering_to_texture_)
+        {
+            submitQueue();
+        }
+        flushBatch();
+    }
+
+    void Renderer::submitQuad(SDL_Texture *texture, const SDL_FRect &src_rect, const SDL_FRect &dest_rect, double angle, bool flipped)
+    {
+        if (rendering_to_texture_)
+        { // 渲染到纹理的内容自成一帧，不参与窗口的排序
+            ++stats_.sprites_submitted;
+            queueQuad(texture, src_rect, dest_rect, angle, flipped);
+            return;
+        }
+        ++stats_.sprites_submitted;
+        render_queue_.submit(render_layer_, {texture, src_rect, dest_rect, static_cast<float>(angle), flipped});
+    }
+
+    void Renderer::submitQueue()
+    {
+        if (render_queue_.empty())
+        {
+            return;
+        }
+        render_queue_.sort();
+        render_queue_.forEachSorted([this](const RenderQueue::DrawItem &item)
+                                    { queueQuad(item.texture, item.src_rect, item.dest_rect, item.angle, item.flipped); });
+        render_queue_.clear();
+    }
+
+    void Renderer::flushBatch()
+    {
+        if (batch_indices_.empty())
+        {
+            return;
+        }
+        ++stats_.draw_calls;
+        stats_.vertices += static_cast<std::uint32_t>(batch_vertices_.size());
+        if (!SDL_RenderGeometry(renderer_, batch_texture_, batch_vertices_.data(), static_cast<int>(batch_vertices_.size()),
+                                batch_indices_.data(), static_cast<int>(batch_indices_.size())))
+        {
+            spdlog::error("提交精灵批次失败：{}", SDL_GetError());
+        }
+        batch_vertices_.clear();
+        batch_indices_.clear();
+    }
+
+    void Renderer::queueQuad(SDL_Texture *texture, const SDL_FRect &src_rect, const SDL_FRect &dest_rect, double angle, bool flipped)
+    {
+        if (texture != batch_texture_ || batch_indices_.size() >= MAX_BATCH_QUADS * 6)
+        {
+            flushBatch();
+            if (texture != batch_texture_)
+            {
+                ++stats_.texture_switches;
+                batch_texture_ = texture;
+            }
+        }
+        // 每个新批次都重新查询尺寸：区块和视差条带纹理会在运行时重建，新纹理可能复用旧地址但尺寸不同
+        if (batch_indices_.empty())
+        {
+            if (!SDL_GetTextureSize(texture, &batch_texture_size_.x, &batch_texture_size_.y))
+            {
+                batch_texture_size_ = {0, 0};
+            }
+        }
+        if (batch_texture_size_.x <= 0.0f || batch_texture_size_.y <= 0.0f)
+        {
+            return;
+        }
+
+        // 纹理坐标（水平翻转时交换左右）
+        auto u0 = src_rect.x / batch_texture_size_.x;
+        auto u1 = (src_rect.x + src_rect.w) / batch_texture_size_.x;
+        auto v0 = src_rect.y / batch_texture_size_.y;
+        auto v1 = (src_rect.y + src_rect.h) / batch_texture_size_.y;
+        if (flipped)
+        {
+            std::swap(u0, u1);
+        }
+
+        // 四个角相对于中心的位置：左上、右上、右下、左下
+        glm::vec2 center = {dest_rect.x + dest_rect.w * 0.5f, dest_rect.y + dest_rect.h * 0.5f};
+        glm::vec2 half = {dest_rect.w * 0.5f, dest_rect.h * 0.5f};
+        glm::vec2 corners[4] = {{-half.x, -half.y}, {half.x, -half.y}, {half.x, half.y}, {-half.x, half.y}};
+        if (angle != 0.0)
+        { // 与 SDL_RenderTextureRotated 一致：屏幕坐标系（y 向下）中顺时针旋转
+            auto radians = static_cast<float>(angle) * std::numbers::pi_v<float> / 180.0f;
+            auto c = std::cos(radians);
+            auto s = std::sin(radians);
+            for (auto &corner : corners)
+            {
+                corner = {corner.x * c - corner.y * s, corner.x * s + corner.y * c};
+            }
+        }
+        const SDL_FPoint tex_coords[4] = {{u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}};
+        const SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+
+        auto base = static_cast<int>(batch_vertices_.size());
+        for (int i = 0; i < 4; ++i)
+        {
+            batch_vertices_.push_back({{center.x + corners[i].x, center.y + corners[i].y}, white, tex_coords[i]});
+        }
+        for (int index : {0, 1, 2, 2, 3, 0})
+        {
+            batch_indices_.push_back(base + index);
+        }
     }
 
     void Renderer::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
@@ -214,15 +427,18 @@ namespace engine::render
         }
     }
 
-    std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite &sprite)
+    SDL_Texture *Renderer::resolveTexture(const Sprite &sprite)
     {
-        SDL_Texture *texture = resource_manager_->getTexture(sprite.getTextureId());
-        if (!texture)
+        // 句柄有效时直接按下标访问；未解析或纹理已被卸载时才按纹理ID查找
+        if (auto *texture = resource_manager_->getTexture(sprite.getTextureHandle()))
         {
-            spdlog::error("无法为ID{}获取纹理", sprite.getTextureId());
-            return std::nullopt;
+            return texture;
         }
+        return resource_manager_->getTexture(sprite.getTextureId());
+    }
 
+    std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite &sprite, SDL_Texture *texture)
+    {
         auto src_rect = sprite.getSourceRect();
         if (src_rect.has_value()) // 有源矩形，拿来用
         {
@@ -1,12 +1,13 @@
 #pragma once
 #include "sprite.h"
+#include "render_queue.h"
+#include "render_stats.h"
 #include "../utils/math.h"
 #include <string>
+#include <vector>
+#include <cstdint>
 #include <optional> // For std::optional
-
-struct SDL_Renderer;
-struct SDL_FRect;
-struct SDL_FColor;
+#include <SDL3/SDL_render.h>
 
 namespace engine::resource
 {
@@ -17,12 +18,38 @@ namespace engine::render
 {
     class Camera;
 
+    /**
+     * @brief 封装 SDL_Renderer 的绘制接口。
+     *
+     * 纹理绘制不会立即提交，而是作为四边形（已包含翻转和旋转）累积到顶点和索引缓冲区中，
+     * 在纹理切换、渲染状态变化（填充矩形、切换渲染目标、清屏）或 present() 时用一次 SDL_RenderGeometry 提交。
+     * 直接使用 SDL_Renderer 绘制的代码（例如文字）需要先调用 flush() 以保持绘制顺序。
+     *
+     * 世界坐标的绘制（drawSprite / drawParallax / drawTexture）先以当前渲染层提交到 RenderQueue，
+     * 在 flush()（或第一次屏幕 UI 绘制）时统一排序后再加入批次；UI 绘制和渲染到纹理时的绘制立即加入批次。
+     */
     class Renderer final
     {
     private:
+        static constexpr size_t MAX_BATCH_QUADS = 4096; // 单个批次的最大四边形数，超过时提前提交
+
         SDL_Renderer *renderer_ = nullptr;
         engine::resource::ResourceManager *resource_manager_ = nullptr; // 借用的指针
 
+        std::vector<SDL_Vertex> batch_vertices_; // 当前批次的顶点（每个四边形4个）
+        std::vector<int> batch_indices_;         // 当前批次的索引（每个四边形6个）
+        SDL_Texture *batch_texture_ = nullptr;   // 当前批次使用的纹理
+        glm::vec2 batch_texture_size_ = {0, 0};  // 当前批次纹理的尺寸（用于计算纹理坐标）
+
+        RenderQueue render_queue_;          // 本帧世界绘制的排序队列
+        int render_layer_ = 0;              // 当前渲染层（之后的世界绘制使用此层）
+        bool rendering_to_texture_ = false; // 是否正在渲染到纹理（此时不提交排序队列）
+
+        RenderStats stats_;             // 本帧目前为止的渲染统计
+        RenderStats last_frame_stats_;  // 上一帧的渲染统计（clearScreen 时保存）
+        int stats_log_interval_ = 0;    // 每隔多少帧把统计输出到日志（0 表示不输出）
+        std::uint64_t frame_index_ = 0; // 已完成的帧数（每次 clearScreen 加一）
+
     public:
         Renderer(SDL_Renderer *sdl_renderer,
                  engine::resource::ResourceManager *resource_manager);
@@ -47,6 +74,14 @@ namespace engine::render
             const glm::bvec2 &repeat = {true, true},
             const glm::vec2 &scale = {1.0f, 1.0f});
 
+        // 以给定的重复单元尺寸绘制视差纹理（每个单元绘制整张纹理，例如预先拼接好的视差条带）
+        void drawParallaxTexture(const Camera &camera,
+                                 SDL_Texture *texture,
+                                 const glm::vec2 &position,
+                                 const glm::vec2 &scroll_factor,
+                                 const glm::bvec2 &repeat,
+                                 const glm::vec2 &tile_size);
+
         void drawUISprite(const Sprite &sprite,
                           const glm::vec2 &position,
                           const std::optional<glm::vec2> &size = std::nullopt);
@@ -54,14 +89,39 @@ namespace engine::render
         void drawUIFilledRect(const engine::utils::Rect &rect,
                               const engine::utils::FColor &color);
 
-        void present();     // 更新屏幕，包装SDL_RenderPresent
-        void clearScreen(); // 清屏，包装SDL_RenderClear
+        void drawTexture(const Camera &camera,
+                         SDL_Texture *texture,
+                         const glm::vec2 &position,
+                         const glm::vec2 &size); // 以世界坐标绘制整张纹理（左上角为 position，视口外不绘制）
+
+        SDL_Texture *createTargetTexture(const glm::ivec2 &size); // 创建可作为渲染目标的透明纹理，失败返回nullptr（调用者负责销毁）
+        bool beginRenderToTexture(SDL_Texture *target);          // 把渲染目标切换到纹理并清空为透明，之后的 drawUI* 以纹理像素为坐标
+        void endRenderToTexture();                               // 把渲染目标恢复为窗口
+
+        void present();     // 更新屏幕，包装SDL_RenderPresent（会先提交批次）
+        void clearScreen(); // 清屏，包装SDL_RenderClear（同时结束上一帧的渲染统计）
+        void flush();       // 排序并提交本帧的世界绘制，再提交当前批次（直接使用 SDL_Renderer 绘制之前调用）
+
+        void setRenderLayer(int layer) { render_layer_ = layer; } // 设置之后世界绘制的渲染层（由场景在渲染每个游戏对象前设置）
+        int getRenderLayer() const { return render_layer_; }      // 获取当前渲染层
+
+        const RenderStats &getStats() const { return stats_; }                      // 获取本帧目前为止的渲染统计
+        const RenderStats &getLastFrameStats() const { return last_frame_stats_; }  // 获取上一帧的渲染统计
+        void setStatsLogInterval(int frames) { stats_log_interval_ = frames; }      // 设置每隔多少帧输出一次统计（0 表示不输出）
+        void addTextStats(std::uint32_t objects_created, std::uint32_t draw_calls); // 记录文字绘制（由 TextRenderer 调用）
 
         void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);       // 包装SDL_SetRenderDrawColor
         void setDrawColorFloat(float r, float g, float b, float a = 1.0f); // 包装SDL_SetRenderDrawColorFloat
 
     private:
-        std::optional<SDL_FRect> getSpriteSrcRect(const Sprite &sprite);    // 获取精灵源矩形，用于绘制
-        bool isRectInViewport(const Camera &camera, const SDL_FRect &rect); // 判断矩形是否在视口内
+        // 把一个纹理四边形加入批次（纹理与当前批次不同时先提交），angle 为绕目标矩形中心顺时针旋转的角度
+        void queueQuad(SDL_Texture *texture, const SDL_FRect &src_rect, const SDL_FRect &dest_rect, double angle = 0.0, bool flipped = false);
+        // 把世界绘制提交到排序队列（渲染到纹理时直接加入批次）
+        void submitQuad(SDL_Texture *texture, const SDL_FRect &src_rect, const SDL_FRect &dest_rect, double angle = 0.0, bool flipped = false);
+        void submitQueue(); // 排序队列中的绘制并按顺序加入批次
+        void flushBatch();  // 用一次 SDL_RenderGeometry 提交当前批次
+        SDL_Texture *resolveTexture(const Sprite &sprite);                                     // 获取精灵的纹理（优先使用句柄）
+        std::optional<SDL_FRect> getSpriteSrcRect(const Sprite &sprite, SDL_Texture *texture); // 获取精灵源矩形，用于绘制
+        bool isRectInViewport(const Camera &camera, const SDL_FRect &rect);                    // 判断矩形是否在视口内
     };
 }
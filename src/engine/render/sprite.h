@@ -2,16 +2,19 @@
 #include <SDL3/SDL_rect.h> // 用于 SDL——FRect
 #include <optional>        // 用于 std::optional 表示可选的源矩形
 #include <string>
+#include "../resource/texture_handle.h"
 
 namespace engine::render
 {
     // 包含纹理标识符和要绘制的纹理部分以及翻转状态
+    // 纹理句柄在加载时由纹理标识符解析一次，绘制时优先使用句柄（无效或已失效时才按标识符查找）
     class Sprite final
     {
     private:
-        std::string texture_id_;               // 纹理资源标识符
-        std::optional<SDL_FRect> source_rect_; // 可选：要绘制的纹理部分
-        bool is_flipped_ = false;              // 是否水平翻转
+        std::string texture_id_;                         // 纹理资源标识符
+        engine::resource::TextureHandle texture_handle_; // 解析后的纹理句柄
+        std::optional<SDL_FRect> source_rect_;           // 可选：要绘制的纹理部分
+        bool is_flipped_ = false;                        // 是否水平翻转
 
     public:
         Sprite() = default;
@@ -24,11 +27,17 @@ namespace engine::render
         }
 
         // getters and setters
-        std::string_view getTextureId() const { return texture_id_; }                  // 获取纹理ID
-        const std::optional<SDL_FRect> &getSourceRect() const { return source_rect_; } // 获取源矩形
-        bool isFlipped() const { return is_flipped_; }                                 // 获取是否水平翻转
+        std::string_view getTextureId() const { return texture_id_; }                        // 获取纹理ID
+        engine::resource::TextureHandle getTextureHandle() const { return texture_handle_; } // 获取纹理句柄
+        const std::optional<SDL_FRect> &getSourceRect() const { return source_rect_; }       // 获取源矩形
+        bool isFlipped() const { return is_flipped_; }                                       // 获取是否水平翻转
 
-        void setTextureId(std::string_view texture_id) { texture_id_ = texture_id; }                   // 设置纹理ID
+        void setTextureId(std::string_view texture_id) // 设置纹理ID（句柄随之失效，需要重新解析）
+        {
+            texture_id_ = texture_id;
+            texture_handle_ = {};
+        }
+        void setTextureHandle(engine::resource::TextureHandle handle) { texture_handle_ = handle; }    // 设置纹理句柄（由纹理ID解析得到）
         void setSourceRect(const std::optional<SDL_FRect> source_rect) { source_rect_ = source_rect; } // 设置源矩形
         void setFlipped(bool flipped) { is_flipped_ = flipped; }                                       // 设置是否水平翻转
     };
@@ -1,5 +1,6 @@
 #include "text_renderer.h"
 #include "camera.h"
+#include "renderer.h"
 #include "../resource/resource_manager.h"
 #include <SDL3_ttf/SDL_ttf.h>
 #include <spdlog/spdlog.h>
@@ -8,9 +9,10 @@
 namespace engine::render
 {
 
-    TextRenderer::TextRenderer(SDL_Renderer *sdl_renderer, engine::resource::ResourceManager *resource_manager)
+    TextRenderer::TextRenderer(SDL_Renderer *sdl_renderer, engine::resource::ResourceManager *resource_manager, Renderer *renderer)
         : sdl_renderer_(sdl_renderer),
-          resource_manager_(resource_manager)
+          resource_manager_(resource_manager),
+          renderer_(renderer)
     {
         if (!sdl_renderer_ || !resource_manager_)
         {
@@ -69,6 +71,12 @@ namespace engine::render
             return;
         }
 
+        // 文字直接通过 SDL_Renderer 绘制，先提交之前累积的精灵
+        if (renderer_)
+        {
+            renderer_->flush();
+        }
+
         // 先渲染一次黑色文字模拟阴影
         TTF_SetTextColorFloat(temp_text_object, 0.0f, 0.0f, 0.0f, 1.0f);
         if (!TTF_DrawRendererText(temp_text_object, position.x + 2, position.y + 2))
@@ -85,6 +93,10 @@ namespace engine::render
 
         // 销毁临时 TTF_Text 对象
         TTF_DestroyText(temp_text_object);
+        if (renderer_)
+        {
+            renderer_->addTextStats(1, 2); // 一个临时文字对象，绘制两次（阴影和正文）
+        }
     }
 
     void TextRenderer::drawText(const Camera &camera, std::string_view text, std::string_view font_id, int font_size,
@@ -120,6 +132,10 @@ namespace engine::render
 
         // 销毁临时 TTF_Text 对象
         TTF_DestroyText(temp_text_object);
+        if (renderer_)
+        {
+            renderer_->addTextStats(1, 0); // 一个临时文字对象，只用于测量，不绘制
+        }
 
         return glm::vec2(static_cast<float>(width), static_cast<float>(height));
     }
@@ -15,6 +15,7 @@ namespace engine::resource
 namespace engine::render
 {
     class Camera;
+    class Renderer;
     /**
      * @brief 使用 SDL_ttf 和 TTF_Text 对象处理文本渲染。
      *
@@ -26,6 +27,7 @@ namespace engine::render
     private:
         SDL_Renderer *sdl_renderer_ = nullptr;                          ///< @brief 持有渲染器的非拥有指针
         engine::resource::ResourceManager *resource_manager_ = nullptr; ///< @brief 持有资源管理器的非拥有指针
+        Renderer *renderer_ = nullptr;                                  ///< @brief 精灵渲染器的非拥有指针（绘制文字前提交其批次，可以为空）
 
         TTF_TextEngine *text_engine_ = nullptr; ///< @brief 使用SDL3引入的 TTF_TextEngine 来进行绘制
 
@@ -35,9 +37,10 @@ namespace engine::render
          *
          * @param sdl_renderer 有效的 SDL_Renderer 指针。
          * @param resource_manager 有效的 ResourceManager 指针（用于字体加载）。
+         * @param renderer 共用同一个 SDL_Renderer 的精灵渲染器，绘制文字前会提交它的批次以保持绘制顺序（可以为空）。
          * @throws std::runtime_error 如果初始化失败。
          */
-        TextRenderer(SDL_Renderer *sdl_renderer, engine::resource::ResourceManager *resource_manager);
+        TextRenderer(SDL_Renderer *sdl_renderer, engine::resource::ResourceManager *resource_manager, Renderer *renderer = nullptr);
 
         ~TextRenderer(); ///< @brief 析构函数，按需调用close()。
 
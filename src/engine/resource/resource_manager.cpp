@@ -59,6 +59,26 @@ namespace engine::resource
         texture_manager_->clearTextures();
     }
 
+    TextureHandle ResourceManager::getTextureHandle(std::string_view file_path)
+    {
+        return texture_manager_->getTextureHandle(file_path);
+    }
+
+    SDL_Texture *ResourceManager::getTexture(TextureHandle handle) const
+    {
+        return texture_manager_->getTexture(handle);
+    }
+
+    glm::vec2 ResourceManager::getTextureSize(TextureHandle handle) const
+    {
+        return texture_manager_->getTextureSize(handle);
+    }
+
+    const TextureAtlas *ResourceManager::buildTextureAtlas(std::string_view name, const std::vector<std::string> &file_paths)
+    {
+        return texture_manager_->buildAtlas(name, file_paths);
+    }
+
     // --- 音频接口实现 ---
     MIX_Audio *ResourceManager::loadSound(std::string_view file_path)
     {
@@ -2,7 +2,9 @@
 #include <memory>      // 用于 std::unique_ptr
 #include <string>      // 用于 std::string
 #include <string_view> // 用于 std::string_view
+#include <vector>      // 用于 std::vector
 #include <glm/glm.hpp>
+#include "texture_handle.h"
 
 // 前向声明 SDL 类型
 struct SDL_Renderer;
@@ -19,6 +21,7 @@ namespace engine::resource
     class TextureManager;
     class AudioManager;
     class FontManager;
+    class TextureAtlas;
 
     /**
      * @brief 作为访问各种资源管理器的中央控制点（外观模式 Facade）。
@@ -51,11 +54,17 @@ namespace engine::resource
 
         // --- 统一资源访问接口 ---
         // -- Texture --
-        SDL_Texture *loadTexture(std::string_view file_path); ///< @brief 载入纹理资源
-        SDL_Texture *getTexture(std::string_view file_path);  ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载
-        void unloadTexture(std::string_view file_path);       ///< @brief 卸载指定的纹理资源
-        glm::vec2 getTextureSize(std::string_view file_path); ///< @brief 获取指定纹理的尺寸
-        void clearTextures();                                 ///< @brief 清空所有纹理资源
+        SDL_Texture *loadTexture(std::string_view file_path);       ///< @brief 载入纹理资源
+        SDL_Texture *getTexture(std::string_view file_path);        ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载
+        void unloadTexture(std::string_view file_path);             ///< @brief 卸载指定的纹理资源
+        glm::vec2 getTextureSize(std::string_view file_path);       ///< @brief 获取指定纹理的尺寸
+        void clearTextures();                                       ///< @brief 清空所有纹理资源
+        // 句柄接口：加载时解析一次句柄，绘制时按下标访问（纹理被卸载后旧句柄失效，返回 nullptr / (0,0)）
+        TextureHandle getTextureHandle(std::string_view file_path); ///< @brief 解析纹理句柄（未加载则先加载），失败返回无效句柄
+        SDL_Texture *getTexture(TextureHandle handle) const;        ///< @brief 通过句柄获取纹理
+        glm::vec2 getTextureSize(TextureHandle handle) const;       ///< @brief 通过句柄获取纹理尺寸
+        /// @brief 把一组图片打包成图集纹理（同名图集只构建一次），没有任何图片被打包时返回 nullptr
+        const TextureAtlas *buildTextureAtlas(std::string_view name, const std::vector<std::string> &file_paths);
 
         // -- Sound Effects (Chunks) --
         MIX_Audio *loadSound(std::string_view file_path); ///< @brief 载入音效资源
@@ -0,0 +1,206 @@
+#include "texture_atlas.h"
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <limits>
+
+namespace engine::resource
+{
+
+    void TextureAtlas::SurfaceDeleter::operator()(SDL_Surface *surface) const
+    {
+        if (surface)
+        {
+            SDL_DestroySurface(surface);
+        }
+    }
+
+    TextureAtlas::~TextureAtlas() = default;
+
+    size_t TextureAtlas::build(const std::vector<std::string> &file_paths, int page_size)
+    {
+        pages_.clear();
+        page_ids_.clear();
+        regions_.clear();
+
+        // 载入所有图片（去重），超过页面尺寸的图片保持独立纹理
+        struct Image
+        {
+            std::string file_path;
+            std::unique_ptr<SDL_Surface, SurfaceDeleter> surface;
+        };
+        std::vector<Image> images;
+        images.reserve(file_paths.size());
+        for (const auto &file_path : file_paths)
+        {
+            if (regions_.contains(file_path) || std::any_of(images.begin(), images.end(), [&file_path](const Image &image)
+                                                             { return image.file_path == file_path; }))
+                continue;
+            std::unique_ptr<SDL_Surface, SurfaceDeleter> surface(IMG_Load(file_path.c_str()));
+            if (!surface)
+            {
+                spdlog::warn("图集 '{}' 载入图片失败，已跳过：'{}': {}", name_, file_path, SDL_GetError());
+                continue;
+            }
+            if (surface->w + PADDING > page_size || surface->h + PADDING > page_size)
+            {
+                spdlog::warn("图片 '{}' ({}x{}) 超过图集页面尺寸 {}，不打包。", file_path, surface->w, surface->h, page_size);
+                continue;
+            }
+            images.push_back({file_path, std::move(surface)});
+        }
+
+        // 按高度降序（相同时按宽度降序）放置，天际线更平整
+        std::stable_sort(images.begin(), images.end(), [](const Image &a, const Image &b)
+                         { return a.surface->h != b.surface->h ? a.surface->h > b.surface->h : a.surface->w > b.surface->w; });
+
+        for (auto &image : images)
+        {
+            glm::ivec2 size = {image.surface->w + PADDING, image.surface->h + PADDING};
+            glm::ivec2 position = {0, 0};
+            size_t page_index = 0;
+            while (page_index < pages_.size() && !insert(pages_[page_index], size, page_size, position))
+                ++page_index;
+
+            // 现有页都放不下，新开一页
+            if (page_index == pages_.size())
+            {
+                Page page;
+                page.surface.reset(SDL_CreateSurface(page_size, page_size, SDL_PIXELFORMAT_RGBA32));
+                if (!page.surface)
+                {
+                    spdlog::error("创建图集页面失败：{}", SDL_GetError());
+                    break;
+                }
+                SDL_FillSurfaceRect(page.surface.get(), nullptr, 0); // 全透明
+                page.skyline.push_back({0, 0, page_size});
+                pages_.push_back(std::move(page));
+                page_ids_.push_back("atlas:" + name_ + "#" + std::to_string(page_index));
+                insert(pages_.back(), size, page_size, position);
+            }
+
+            // 直接复制像素（包括 alpha），不与页面混合
+            SDL_SetSurfaceBlendMode(image.surface.get(), SDL_BLENDMODE_NONE);
+            SDL_Rect dest = {position.x, position.y, image.surface->w, image.surface->h};
+            if (!SDL_BlitSurface(image.surface.get(), nullptr, pages_[page_index].surface.get(), &dest))
+            {
+                spdlog::warn("复制图片 '{}' 到图集失败：{}", image.file_path, SDL_GetError());
+                continue;
+            }
+            auto &page = pages_[page_index];
+            page.used_size = glm::max(page.used_size, position + glm::ivec2(image.surface->w, image.surface->h));
+            regions_[image.file_path] = {page_ids_[page_index], glm::vec2(position), glm::vec2(image.surface->w, image.surface->h)};
+        }
+
+        // 把每页裁剪到实际使用的范围，减少显存占用
+        for (auto &page : pages_)
+        {
+            if (page.used_size.x <= 0 || page.used_size.y <= 0 || (page.used_size.x == page_size && page.used_size.y == page_size))
+                continue;
+            std::unique_ptr<SDL_Surface, SurfaceDeleter> cropped(SDL_CreateSurface(page.used_size.x, page.used_size.y, SDL_PIXELFORMAT_RGBA32));
+            if (!cropped)
+                continue;
+            SDL_SetSurfaceBlendMode(page.surface.get(), SDL_BLENDMODE_NONE);
+            SDL_Rect src = {0, 0, page.used_size.x, page.used_size.y};
+            if (SDL_BlitSurface(page.surface.get(), &src, cropped.get(), nullptr))
+            {
+                page.surface = std::move(cropped);
+            }
+        }
+
+        spdlog::info("图集 '{}' 构建完成：{} 张图片，{} 页", name_, regions_.size(), pages_.size());
+        return regions_.size();
+    }
+
+    const TextureAtlas::Region *TextureAtlas::findRegion(std::string_view file_path) const
+    {
+        auto it = regions_.find(std::string(file_path));
+        return it != regions_.end() ? &it->second : nullptr;
+    }
+
+    SDL_Surface *TextureAtlas::getPageSurface(size_t index) const
+    {
+        return index < pages_.size() ? pages_[index].surface.get() : nullptr;
+    }
+
+    void TextureAtlas::releasePageSurfaces()
+    {
+        for (auto &page : pages_)
+        {
+            page.surface.reset();
+            page.skyline.clear();
+            page.skyline.shrink_to_fit();
+        }
+    }
+
+    bool TextureAtlas::insert(Page &page, glm::ivec2 size, int page_size, glm::ivec2 &position)
+    {
+        // 选择使矩形顶部最低的位置，相同时选择最靠左的
+        auto best_bottom = std::numeric_limits<int>::max();
+        auto best_index = page.skyline.size();
+        for (size_t i = 0; i < page.skyline.size(); ++i)
+        {
+            auto y = fitAt(page, i, size, page_size);
+            if (y >= 0 && y + size.y < best_bottom)
+            {
+                best_bottom = y + size.y;
+                best_index = i;
+                position = {page.skyline[i].x, y};
+            }
+        }
+        if (best_index == page.skyline.size())
+            return false;
+
+        // 插入新线段，并截掉被它覆盖的后续线段
+        auto &skyline = page.skyline;
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(best_index), {position.x, position.y + size.y, size.x});
+        auto right = position.x + size.x;
+        auto i = best_index + 1;
+        while (i < skyline.size() && skyline[i].x < right)
+        {
+            auto shrink = right - skyline[i].x;
+            skyline[i].x += shrink;
+            skyline[i].width -= shrink;
+            if (skyline[i].width > 0)
+                break;
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+
+        // 合并高度相同的相邻线段
+        for (size_t j = 0; j + 1 < skyline.size();)
+        {
+            if (skyline[j].y == skyline[j + 1].y)
+            {
+                skyline[j].width += skyline[j + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(j) + 1);
+            }
+            else
+            {
+                ++j;
+            }
+        }
+        return true;
+    }
+
+    int TextureAtlas::fitAt(const Page &page, size_t index, glm::ivec2 size, int page_size)
+    {
+        const auto &skyline = page.skyline;
+        if (skyline[index].x + size.x > page_size)
+            return -1;
+        // 矩形跨越的所有线段中最高的一段决定了它的底部
+        auto y = 0;
+        auto width_left = size.x;
+        for (auto i = index; width_left > 0; ++i)
+        {
+            if (i >= skyline.size())
+                return -1;
+            y = std::max(y, skyline[i].y);
+            if (y + size.y > page_size)
+                return -1;
+            width_left -= skyline[i].width;
+        }
+        return y;
+    }
+
+} // namespace engine::resource
@@ -0,0 +1,97 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+struct SDL_Surface;
+
+namespace engine::resource
+{
+    /**
+     * @brief 运行时纹理图集：把多张小图打包进少量大纹理（页），减少纹理切换，使绘制能够合批。
+     *
+     * 采用 skyline（天际线）左下优先算法：每页维护一条由水平线段组成的“天际线”，
+     * 每张图放在使其顶部最低（相同时最靠左）的位置。图片按高度降序依次放入第一个放得下的页，
+     * 都放不下时新开一页。图片之间留 PADDING 像素的透明间隔，避免采样时相互渗色。
+     *
+     * 本类只负责在 CPU 端打包像素，页面上传为纹理由 TextureManager 完成。
+     */
+    class TextureAtlas final
+    {
+    public:
+        static constexpr int PADDING = 1; ///< @brief 图片之间的间隔（像素）
+
+        /// @brief 图片在图集中的位置
+        struct Region
+        {
+            std::string texture_id;             ///< @brief 所在页的纹理 ID
+            glm::vec2 offset = {0.0f, 0.0f};    ///< @brief 图片左上角在页中的坐标（像素）
+            glm::vec2 size = {0.0f, 0.0f};      ///< @brief 图片尺寸（像素）
+        };
+
+    private:
+        struct SurfaceDeleter
+        {
+            void operator()(SDL_Surface *surface) const;
+        };
+
+        /// @brief 天际线中的一段水平线段
+        struct SkylineNode
+        {
+            int x = 0;     ///< @brief 起点 x
+            int y = 0;     ///< @brief 线段高度（其上方为空闲区域）
+            int width = 0; ///< @brief 线段宽度
+        };
+
+        /// @brief 正在打包的页
+        struct Page
+        {
+            std::unique_ptr<SDL_Surface, SurfaceDeleter> surface; ///< @brief 页面像素
+            std::vector<SkylineNode> skyline;                     ///< @brief 当前天际线（按 x 升序）
+            glm::ivec2 used_size = {0, 0};                        ///< @brief 已使用的范围（用于裁剪页面）
+        };
+
+        std::string name_;                                      ///< @brief 图集名称
+        std::vector<Page> pages_;                               ///< @brief 所有页
+        std::vector<std::string> page_ids_;                     ///< @brief 每页的纹理 ID
+        std::unordered_map<std::string, Region> regions_;       ///< @brief 图片路径 → 图集中的位置
+
+    public:
+        explicit TextureAtlas(std::string_view name) : name_(name) {}
+        ~TextureAtlas();
+
+        TextureAtlas(const TextureAtlas &) = delete;
+        TextureAtlas &operator=(const TextureAtlas &) = delete;
+        TextureAtlas(TextureAtlas &&) = delete;
+        TextureAtlas &operator=(TextureAtlas &&) = delete;
+
+        /**
+         * @brief 载入并打包图片（重复路径只打包一次）。
+         * @param file_paths 图片路径列表
+         * @param page_size 每页的最大尺寸（像素），超过此尺寸的图片不会被打包
+         * @return 打包成功的图片数量
+         */
+        size_t build(const std::vector<std::string> &file_paths, int page_size);
+
+        /// @brief 查找图片在图集中的位置，未打包的图片返回 nullptr
+        const Region *findRegion(std::string_view file_path) const;
+
+        const std::string &getName() const { return name_; }                        ///< @brief 获取图集名称
+        const std::vector<std::string> &getPageIds() const { return page_ids_; }    ///< @brief 获取每页的纹理 ID
+        SDL_Surface *getPageSurface(size_t index) const;                            ///< @brief 获取页面像素（释放后返回 nullptr）
+        void releasePageSurfaces();                                                 ///< @brief 页面上传为纹理后释放 CPU 端像素
+
+    private:
+        /**
+         * @brief 在页中为 size 大小的矩形寻找位置并更新天际线
+         * @return 找到时返回 true，位置写入 position
+         */
+        static bool insert(Page &page, glm::ivec2 size, int page_size, glm::ivec2 &position);
+        /// @brief 计算矩形放在第 index 段线段起点时的底部高度，放不下时返回 -1
+        static int fitAt(const Page &page, size_t index, glm::ivec2 size, int page_size);
+    };
+
+} // namespace engine::resource
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::resource
+{
+    /**
+     * @brief 纹理句柄：TextureManager 中纹理槽位的下标加代数。
+     *
+     * 在加载关卡或组件时由纹理路径解析一次，之后绘制时只需按下标访问数组，不再进行字符串哈希查找。
+     * 纹理被卸载后槽位的代数会增加，旧句柄随之失效（查询返回 nullptr），不会指向之后复用该槽位的其它纹理。
+     */
+    struct TextureHandle
+    {
+        static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu; ///< @brief 无效下标
+
+        std::uint32_t index = INVALID_INDEX; ///< @brief 槽位下标
+        std::uint32_t generation = 0;        ///< @brief 解析时槽位的代数
+
+        bool isValid() const { return index != INVALID_INDEX; } ///< @brief 是否已解析（不保证纹理仍未被卸载）
+        bool operator==(const TextureHandle &) const = default;
+    };
+
+} // namespace engine::resource
@@ -13,6 +13,7 @@
 #include <SDL3_image/SDL_image.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include <algorithm>
 
 // ==============================
 // 命名空间与实现
@@ -44,31 +45,111 @@ namespace engine::resource
     SDL_Texture *TextureManager::loadTexture(std::string_view file_path)
     {
         // 检查是否已经加载
-        auto it = textures_.find(std::string(file_path));
-        if (it != textures_.end())
+        auto it = slot_indices_.find(std::string(file_path));
+        if (it != slot_indices_.end())
         {
-            return it->second.get();
+            return slots_[it->second].texture.get();
         }
 
         // 如果没有加载则尝试加载
         SDL_Texture *raw_texture = IMG_LoadTexture(renderer_, file_path.data());
+        if (!raw_texture)
+        {
+            spdlog::error("加载纹理失败：'{}':{}", file_path, SDL_GetError());
+            return nullptr;
+        }
 
         if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) // 最邻近插值优化画面
         {
             spdlog::warn("无法设置纹理模式为最邻近插值");
         }
 
+        storeTexture(file_path, raw_texture);
+        spdlog::debug("成功载入并缓存纹理：{}", file_path);
+
+        return raw_texture;
+    }
+
+    /**
+     * @brief 从内存中的像素创建纹理并以 id 缓存（已存在同名纹理时先卸载旧纹理）
+     *
+     * @param id 纹理 ID，之后可像文件路径一样用于查询和解析句柄
+     * @param surface 像素数据（不转移所有权）
+     * @return 成功返回SDL_Texture指针，失败返回nullptr
+     */
+    SDL_Texture *TextureManager::addTexture(std::string_view id, SDL_Surface *surface)
+    {
+        if (!surface)
+        {
+            spdlog::error("创建纹理失败：'{}' 的像素数据为空", id);
+            return nullptr;
+        }
+        SDL_Texture *raw_texture = SDL_CreateTextureFromSurface(renderer_, surface);
         if (!raw_texture)
         {
-            spdlog::error("加载纹理失败：'{}':{}", file_path, SDL_GetError());
+            spdlog::error("创建纹理失败：'{}':{}", id, SDL_GetError());
             return nullptr;
         }
-        textures_.emplace(file_path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture));
-        spdlog::debug("成功载入并缓存纹理：{}", file_path);
+        if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST))
+        {
+            spdlog::warn("无法设置纹理模式为最邻近插值");
+        }
+
+        // 替换同名纹理（旧句柄随代数增加而失效）
+        auto it = slot_indices_.find(std::string(id));
+        if (it != slot_indices_.end())
+        {
+            releaseSlot(it->second);
+            slot_indices_.erase(it);
+        }
+        storeTexture(id, raw_texture);
+        spdlog::debug("成功创建并缓存纹理：{}", id);
 
         return raw_texture;
     }
 
+    /**
+     * @brief 把一组图片打包成图集并上传为纹理（同名图集已存在时直接返回）
+     *
+     * @param name 图集名称
+     * @param file_paths 图片路径列表
+     * @return 成功返回图集指针，没有任何图片被打包时返回nullptr
+     */
+    const TextureAtlas *TextureManager::buildAtlas(std::string_view name, const std::vector<std::string> &file_paths)
+    {
+        auto it = atlases_.find(std::string(name));
+        if (it != atlases_.end())
+        {
+            return it->second.get();
+        }
+
+        // 页面尺寸受渲染器最大纹理尺寸限制
+        auto page_size = 2048;
+        auto max_size = SDL_GetNumberProperty(SDL_GetRendererProperties(renderer_), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+        if (max_size > 0)
+        {
+            page_size = static_cast<int>(std::min<Sint64>(page_size, max_size));
+        }
+
+        auto atlas = std::make_unique<TextureAtlas>(name);
+        if (atlas->build(file_paths, page_size) == 0)
+        {
+            spdlog::warn("图集 '{}' 没有打包任何图片", name);
+            return nullptr;
+        }
+        for (size_t i = 0; i < atlas->getPageIds().size(); ++i)
+        {
+            if (!addTexture(atlas->getPageIds()[i], atlas->getPageSurface(i)))
+            {
+                spdlog::error("图集 '{}' 第 {} 页上传失败，不使用该图集", name, i);
+                return nullptr;
+            }
+        }
+        atlas->releasePageSurfaces(); // 像素已上传，释放内存副本
+
+        return atlases_.emplace(std::string(name), std::move(atlas)).first->second.get();
+    }
+
     /**
      * @brief 获取已加载的纹理（不存在则尝试自动加载）
      *
@@ -77,10 +158,10 @@ namespace engine::resource
      */
     SDL_Texture *TextureManager::getTexture(std::string_view file_path)
     {
-        auto it = textures_.find(std::string(file_path));
-        if (it != textures_.end())
+        auto it = slot_indices_.find(std::string(file_path));
+        if (it != slot_indices_.end())
         {
-            return it->second.get();
+            return slots_[it->second].texture.get();
         }
 
         spdlog::warn("未缓存纹理'{}'，尝试加载它", file_path);
@@ -88,6 +169,37 @@ namespace engine::resource
         return loadTexture(file_path);
     }
 
+    /**
+     * @brief 解析纹理句柄（未加载则先加载）
+     *
+     * @param file_path 纹理文件路径
+     * @return 纹理句柄，加载失败返回无效句柄
+     */
+    TextureHandle TextureManager::getTextureHandle(std::string_view file_path)
+    {
+        if (!loadTexture(file_path))
+        {
+            return TextureHandle{};
+        }
+        auto index = slot_indices_.at(std::string(file_path));
+        return TextureHandle{index, slots_[index].generation};
+    }
+
+    /**
+     * @brief 通过句柄获取纹理尺寸
+     *
+     * @param handle 纹理句柄
+     * @return 包含宽高的glm::vec2，句柄失效时返回(0,0)
+     */
+    glm::vec2 TextureManager::getTextureSize(TextureHandle handle) const
+    {
+        if (!getTexture(handle))
+        {
+            return glm::vec2(0);
+        }
+        return slots_[handle.index].size;
+    }
+
     /**
      * @brief 卸载指定路径的纹理资源
      *
@@ -95,11 +207,12 @@ namespace engine::resource
      */
     void TextureManager::unloadTexture(std::string_view file_path)
     {
-        auto it = textures_.find(std::string(file_path));
-        if (it != textures_.end())
+        auto it = slot_indices_.find(std::string(file_path));
+        if (it != slot_indices_.end())
         {
             spdlog::debug("卸载纹理：{}", file_path);
-            textures_.erase(it); // 借助删除器删除
+            releaseSlot(it->second); // 借助删除器删除
+            slot_indices_.erase(it);
         }
         else
         {
@@ -115,20 +228,12 @@ namespace engine::resource
      */
     glm::vec2 TextureManager::getTextureSize(std::string_view file_path)
     {
-        SDL_Texture *texture = getTexture(file_path);
-        if (!texture)
+        if (!getTexture(file_path))
         {
             spdlog::error("无法获取纹理：{}", file_path);
             return glm::vec2(0);
         }
-
-        glm::vec2 size; // 完全保留原代码的size变量定义
-        if (!SDL_GetTextureSize(texture, &size.x, &size.y))
-        {
-            spdlog::error("无法查询纹理尺寸：{}", file_path);
-            return glm::vec2(0);
-        }
-        return size;
+        return slots_[slot_indices_.at(std::string(file_path))].size;
     }
 
     /**
@@ -136,8 +241,59 @@ namespace engine::resource
      */
     void TextureManager::clearTextures()
     {
-        textures_.clear();
+        for (const auto &[file_path, index] : slot_indices_)
+        {
+            releaseSlot(index);
+        }
+        slot_indices_.clear();
+        atlases_.clear();
         spdlog::info("所有纹理已清空");
     }
 
+    /**
+     * @brief 释放槽位中的纹理，增加代数并放回空闲列表
+     *
+     * @param index 槽位下标
+     */
+    void TextureManager::releaseSlot(std::uint32_t index)
+    {
+        auto &slot = slots_[index];
+        slot.texture.reset();
+        slot.file_path.clear();
+        slot.size = glm::vec2(0);
+        ++slot.generation; // 使指向此槽位的旧句柄失效
+        free_slots_.push_back(index);
+    }
+
+    /**
+     * @brief 把纹理放入空闲槽位（或新槽位）并以 id 缓存
+     *
+     * @param id 纹理 ID（文件路径）
+     * @param texture 纹理（转移所有权）
+     */
+    void TextureManager::storeTexture(std::string_view id, SDL_Texture *texture)
+    {
+        // 优先复用空闲槽位（代数已在卸载时增加）
+        std::uint32_t index;
+        if (!free_slots_.empty())
+        {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        }
+        else
+        {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+        auto &slot = slots_[index];
+        slot.texture.reset(texture);
+        slot.file_path = id;
+        if (!SDL_GetTextureSize(texture, &slot.size.x, &slot.size.y))
+        {
+            spdlog::error("无法查询纹理尺寸：{}", id);
+            slot.size = glm::vec2(0);
+        }
+        slot_indices_.emplace(id, index);
+    }
+
 } // namespace engine::resource
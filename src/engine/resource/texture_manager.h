@@ -8,10 +8,14 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 // ==============================
 // 其它文件引入
 // ==============================
+#include "texture_handle.h"
+#include "texture_atlas.h"
 
 // ==============================
 // 第三方库头文件
@@ -30,6 +34,8 @@ namespace engine::resource
      *
      * 负责SDL纹理的加载、缓存、卸载和尺寸查询，使用智能指针+自定义删除器管理纹理生命周期，
      * 避免内存泄漏。仅允许ResourceManager作为友元类访问，确保资源管理的唯一性。
+     *
+     * 纹理存放在槽位数组中，路径只用于加载时查找槽位；绘制时通过 TextureHandle 直接按下标访问。
      */
     class TextureManager
     {
@@ -54,9 +60,27 @@ namespace engine::resource
             }
         };
 
+        /**
+         * @struct TextureSlot
+         * @brief 纹理槽位，卸载后槽位保留并增加代数，供之后加载的纹理复用
+         */
+        struct TextureSlot
+        {
+            std::unique_ptr<SDL_Texture, SDLTextureDeleter> texture; // 纹理（为空表示槽位空闲）
+            std::string file_path;                                   // 纹理文件路径
+            glm::vec2 size = {0.0f, 0.0f};                           // 纹理尺寸（加载时查询一次）
+            std::uint32_t generation = 0;                            // 槽位代数，每次卸载加一
+        };
+
         // 私有成员变量
-        // 纹理缓存映射表：文件路径 → 带自定义删除器的SDL_Texture智能指针
-        std::unordered_map<std::string, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
+        // 纹理槽位数组：TextureHandle::index → 槽位（槽位只增不减，保证代数不会被重置）
+        std::vector<TextureSlot> slots_;
+        // 纹理缓存映射表：文件路径 → 槽位下标（只在加载和解析句柄时使用）
+        std::unordered_map<std::string, std::uint32_t> slot_indices_;
+        // 空闲槽位下标
+        std::vector<std::uint32_t> free_slots_;
+        // 已构建的图集：图集名称 → 图集（图集的页作为普通纹理存放在槽位中）
+        std::unordered_map<std::string, std::unique_ptr<TextureAtlas>> atlases_;
         // SDL渲染器指针（非拥有权，由外部ResourceManager传入并保证生命周期）
         SDL_Renderer *renderer_ = nullptr;
 
@@ -85,6 +109,26 @@ namespace engine::resource
          */
         SDL_Texture *loadTexture(std::string_view file_path);
 
+        /**
+         * @brief 从内存中的像素创建纹理并以 id 缓存（已存在同名纹理时先卸载旧纹理）
+         *
+         * @param id 纹理 ID，之后可像文件路径一样用于查询和解析句柄
+         * @param surface 像素数据（不转移所有权）
+         * @return 成功返回SDL_Texture指针，失败返回nullptr
+         */
+        SDL_Texture *addTexture(std::string_view id, SDL_Surface *surface);
+
+        /**
+         * @brief 把一组图片打包成图集并上传为纹理（同名图集已存在时直接返回）
+         *
+         * 每页的尺寸不超过 2048 和渲染器支持的最大纹理尺寸，页面以 "atlas:<name>#<页号>" 为 ID 缓存。
+         *
+         * @param name 图集名称
+         * @param file_paths 图片路径列表
+         * @return 成功返回图集指针，没有任何图片被打包时返回nullptr
+         */
+        const TextureAtlas *buildAtlas(std::string_view name, const std::vector<std::string> &file_paths);
+
         /**
          * @brief 获取已加载的纹理（不存在则尝试自动加载）
          *
@@ -93,6 +137,38 @@ namespace engine::resource
          */
         SDL_Texture *getTexture(std::string_view file_path);
 
+        /**
+         * @brief 解析纹理句柄（未加载则先加载）
+         *
+         * @param file_path 纹理文件路径
+         * @return 纹理句柄，加载失败返回无效句柄
+         */
+        TextureHandle getTextureHandle(std::string_view file_path);
+
+        /**
+         * @brief 通过句柄获取纹理（按下标访问，不进行字符串查找）
+         *
+         * @param handle 纹理句柄
+         * @return 成功返回SDL_Texture指针；句柄无效或纹理已被卸载时返回nullptr
+         */
+        SDL_Texture *getTexture(TextureHandle handle) const
+        {
+            if (handle.index >= slots_.size())
+            {
+                return nullptr;
+            }
+            const auto &slot = slots_[handle.index];
+            return slot.generation == handle.generation ? slot.texture.get() : nullptr;
+        }
+
+        /**
+         * @brief 通过句柄获取纹理尺寸
+         *
+         * @param handle 纹理句柄
+         * @return 包含宽高的glm::vec2，句柄失效时返回(0,0)
+         */
+        glm::vec2 getTextureSize(TextureHandle handle) const;
+
         /**
          * @brief 卸载指定路径的纹理资源
          *
@@ -112,5 +188,20 @@ namespace engine::resource
          * @brief 清空所有已加载的纹理资源
          */
         void clearTextures();
+
+        /**
+         * @brief 释放槽位中的纹理，增加代数并放回空闲列表
+         *
+         * @param index 槽位下标
+         */
+        void releaseSlot(std::uint32_t index);
+
+        /**
+         * @brief 把纹理放入空闲槽位（或新槽位）并以 id 缓存
+         *
+         * @param id 纹理 ID（文件路径）
+         * @param texture 纹理（转移所有权）
+         */
+        void storeTexture(std::string_view id, SDL_Texture *texture);
     };
 }
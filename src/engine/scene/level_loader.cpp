@@ -17,17 +17,29 @@
 #include "../object/game_object.h"
 
 #include "../resource/resource_manager.h"
+#include "../resource/texture_atlas.h"
 
 #include "../render/sprite.h"
 #include "../render/animation.h"
 
+#include "../physics/collider.h"
+#include "../physics/body_storage.h"
+#include "../physics/height_profile_table.h"
+#include "../physics/physics_engine.h"
+
 #include "../utils/math.h"
 
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <spdlog/spdlog.h>
 #include <glm/vec2.hpp>
+#include <glm/glm.hpp>
 #include <filesystem>
+#include <vector>
+#include <cmath>
+#include <numbers>
+#include <cstdlib>
+#include <algorithm>
 
 namespace engine::scene
 {
@@ -73,8 +85,11 @@ namespace engine::scene
                 auto tileset_path = resolvePath(tileset_json["source"].get<std::string>(), map_path_); // 支持隐式转换，可以省略.get<T>()方法，
                 auto first_gid = tileset_json["firstgid"].get<int>();
                 loadTileset(tileset_path, first_gid);
+                registerHeightProfiles(first_gid, scene.getContext().getPhysicsEngine().getHeightProfiles());
             }
         }
+        // 把瓦片集引用的图片打包成图集，之后解析的 Sprite 都指向图集
+        buildTextureAtlas(json_data, scene.getContext().getResourceManager());
 
         // 5. 加载图层数据
         if (!json_data.contains("layers") || !json_data["layers"].is_array())
@@ -82,8 +97,11 @@ namespace engine::scene
             spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", level_path);
             return false;
         }
+        render_layer_ = -1;
         for (const auto &layer_json : json_data["layers"])
         {
+            // 图层在 Tiled 中的序号即渲染层（靠后的图层绘制在上方）
+            ++render_layer_;
             // 获取各图层对象中的类型（type）字段
             std::string layer_type = layer_json.value("type", "none");
             if (!layer_json.value("visible", true))
@@ -145,6 +163,7 @@ namespace engine::scene
         game_object->addComponent<engine::component::TransformComponent>(offset);
         game_object->addComponent<engine::component::ParallaxComponent>(texture_id, scroll_factor, repeat);
         // 添加到场景中
+        game_object->setRenderLayer(render_layer_);
         scene.addGameObject(std::move(game_object));
         spdlog::info("加载图层: '{}' 完成", layer_name);
     }
@@ -163,10 +182,16 @@ namespace engine::scene
         // 获取图层数据 (瓦片 ID 列表)
         const auto &data = layer_json["data"];
 
-        // 根据gid获取必要信息，并依次填充 TileInfo Vector
+        // 根据gid获取必要信息，并依次填充 TileInfo Vector（纹理句柄在这里解析，绘制时不再按路径查找）
+        auto &resource_manager = scene.getContext().getResourceManager();
         for (const auto &gid : data)
         {
-            tiles.push_back(getTileInfoByGid(gid));
+            auto tile_info = getTileInfoByGid(gid);
+            if (!tile_info.sprite.getTextureId().empty())
+            {
+                tile_info.sprite.setTextureHandle(resource_manager.getTextureHandle(tile_info.sprite.getTextureId()));
+            }
+            tiles.push_back(std::move(tile_info));
         }
 
         // 获取图层名称
@@ -176,6 +201,7 @@ namespace engine::scene
         // 添加Tilelayer组件
         game_object->addComponent<engine::component::TileLayerComponent>(tile_size_, map_size_, std::move(tiles));
         // 添加到场景中
+        game_object->setRenderLayer(render_layer_);
         scene.addGameObject(std::move(game_object));
         spdlog::info("加载瓦片图层: '{}' 完成", layer_name);
     }
@@ -198,57 +224,57 @@ namespace engine::scene
             if (gid == 0)
             {
                 // 如果gid为0 (即不存在)，则代表自己绘制的形状
-                // TODO
-                // 非矩形对象会有额外标识（目前不考虑）
+                // 点对象没有面积，不创建碰撞器
                 if (object.value("point", false))
-                {             // 如果是点对象
+                {
                     continue; // TODO: 点对象的处理方式
                 }
-                else if (object.value("ellipse", false))
-                {             // 如果是椭圆对象
-                    continue; // TODO: 椭圆对象的处理方式
-                }
-                else if (object.value("polygon", false))
-                {             // 如果是多边形对象
-                    continue; // TODO: 多边形对象的处理方式
-                }
-                // 没有这些标识则默认是矩形对象
-                else
+                // --- 根据形状创建碰撞器 (矩形、椭圆、胶囊体、多边形) ---
+                glm::vec2 collider_offset = {0.0f, 0.0f};
+                auto collider = createShapeCollider(object, collider_offset);
+                std::string object_name = object.value("name", "Unnamed");
+                if (!collider)
                 {
-                    // --- 创建游戏对象并添加TransfromComponent ---
-                    std::string object_name = object.value("name", "Unnamed");
-                    auto game_object = std::make_unique<engine::object::GameObject>(object_name);
-                    // 获取Transform相关信息 （自定义形状的坐标针对左上角）
-                    auto position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
-                    auto dst_size = glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f));
-                    auto rotation = object.value("rotation", 0.0f);
-                    // 添加TransformComponent，缩放为设定为1.0f
-                    game_object->addComponent<engine::component::TransformComponent>(position, glm::vec2(1.0f), rotation);
-
-                    // --- 添加碰撞组件和物理组件 ---
-                    // 碰撞盒大小与dst_size相同
-                    auto collider = std::make_unique<engine::physics::AABBCollider>(dst_size);
-                    auto *cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                    // 自定义形状通常是trigger类型，除非显示指定 （因此默认为真）
-                    cc->setTrigger(object.value("trigger", true));
-                    // 添加物理组件，不受重力影响
-                    game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
+                    spdlog::warn("自定义形状对象 '{}' 的形状无效，已跳过。", object_name);
+                    continue;
+                }
 
-                    // 获取标签信息并设置
-                    if (auto tag = getTileProperty<std::string>(object, "tag"); tag)
-                    { // 如果有标签
-                        game_object->setTag(tag.value());
-                    }
-                    // 添加到场景
-                    scene.addGameObject(std::move(game_object));
-                    spdlog::info("加载对象: '{}' 完成 (类型: 自定义形状)", object_name);
+                // --- 创建游戏对象并添加TransfromComponent ---
+                auto game_object = std::make_unique<engine::object::GameObject>(object_name);
+                // 获取Transform相关信息 （自定义形状的坐标针对左上角）
+                auto position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
+                auto rotation = object.value("rotation", 0.0f);
+                // 添加TransformComponent，缩放为设定为1.0f
+                game_object->addComponent<engine::component::TransformComponent>(position, glm::vec2(1.0f), rotation);
+
+                // --- 添加碰撞组件和物理组件 ---
+                auto *cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
+                cc->setOffset(collider_offset);
+                // 自定义形状通常是trigger类型，除非显示指定 （因此默认为真）
+                cc->setTrigger(object.value("trigger", true));
+                // 添加物理组件，不受重力影响
+                game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
+
+                // 获取标签信息并设置
+                if (auto tag = getTileProperty<std::string>(object, "tag"); tag)
+                { // 如果有标签
+                    game_object->setTag(tag.value());
                 }
+                // 设置碰撞类别和掩码
+                setupCollisionFilter(*game_object, object, object);
+                // 设置物体类型 (自定义形状默认为静态)
+                setupBodyType(*game_object, object, object);
+                // 添加到场景
+                game_object->setRenderLayer(render_layer_);
+                scene.addGameObject(std::move(game_object));
+                spdlog::info("加载对象: '{}' 完成 (类型: 自定义形状)", object_name);
             }
             else
             {
                 // 如果gid存在，则按照图片解析流程
                 // --- 根据gid获取必要信息，每个gid对应一个游戏对象 ---
-                auto tile_info = getTileInfoByGid(gid);
+                glm::vec2 atlas_offset(0.0f);
+                auto tile_info = getTileInfoByGid(gid, &atlas_offset);
                 if (tile_info.sprite.getTextureId().empty())
                 {
                     spdlog::error("gid为 {} 的瓦片没有图像纹理。", gid);
@@ -316,6 +342,8 @@ namespace engine::scene
                 {
                     game_object->setTag("hazard");
                 }
+                // 设置碰撞类别和掩码 (需要在标签确定之后)
+                setupCollisionFilter(*game_object, object, tile_json.value_or(nlohmann::json::object()));
 
                 // 获取重力信息并设置
                 auto gravity = getTileProperty<bool>(tile_json, "gravity");
@@ -332,6 +360,8 @@ namespace engine::scene
                         game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), gravity.value());
                     }
                 }
+                // 设置物体类型 (需要在物理组件添加之后)
+                setupBodyType(*game_object, object, tile_json.value_or(nlohmann::json::object()));
 
                 // 获取动画信息并设置
                 auto anim_string = getTileProperty<std::string>(tile_json, "animation");
@@ -351,7 +381,7 @@ namespace engine::scene
                     // 添加AnimationComponent
                     auto *ac = game_object->addComponent<engine::component::AnimationComponent>();
                     // 添加动画到 AnimationComponent
-                    addAnimation(anim_json, ac, src_size);
+                    addAnimation(anim_json, ac, src_size, atlas_offset);
                 }
 
                 // 获取音效信息并设置
@@ -385,13 +415,15 @@ namespace engine::scene
                 }
 
                 // 添加到场景中
+                game_object->setRenderLayer(render_layer_);
                 scene.addGameObject(std::move(game_object));
                 spdlog::info("加载对象:'{}'完成", object_name);
             }
         }
     }
 
-    void LevelLoader::addAnimation(const nlohmann::json &anim_json, engine::component::AnimationComponent *ac, const glm::vec2 &sprite_size)
+    void LevelLoader::addAnimation(const nlohmann::json &anim_json, engine::component::AnimationComponent *ac, const glm::vec2 &sprite_size,
+                                   const glm::vec2 &texture_offset)
     {
         // 检查 anim_json 必须是一个对象，并且 ac 不能为 nullptr
         if (!anim_json.is_object() || !ac)
@@ -432,10 +464,10 @@ namespace engine::scene
                     ;
                 }
                 auto column = frame.get<int>();
-                // 计算源矩形
+                // 计算源矩形（图片在图集中时加上其偏移）
                 SDL_FRect src_rect = {
-                    column * sprite_size.x,
-                    row * sprite_size.y,
+                    texture_offset.x + column * sprite_size.x,
+                    texture_offset.y + row * sprite_size.y,
                     sprite_size.x,
                     sprite_size.y};
                 // 添加动画帧到 Animation
@@ -467,6 +499,146 @@ namespace engine::scene
             audio_component->addSound(sound_id, sound_path);
         }
     }
+    void LevelLoader::setupCollisionFilter(engine::object::GameObject &game_object, const nlohmann::json &object_json, const nlohmann::json &tile_json)
+    {
+        namespace category = engine::physics::category;
+        auto *cc = game_object.getComponent<engine::component::ColliderComponent>();
+        if (!cc)
+        {
+            return;
+        }
+
+        // 根据标签推导默认类别
+        auto tag = game_object.getTag();
+        std::uint32_t default_category = category::DEFAULT;
+        if (tag == "solid")
+            default_category = category::SOLID;
+        else if (tag == "player")
+            default_category = category::PLAYER;
+        else if (tag == "enemy")
+            default_category = category::ENEMY;
+        else if (tag == "item")
+            default_category = category::ITEM;
+        else if (tag == "hazard")
+            default_category = category::HAZARD;
+        else if (cc->isTrigger())
+            default_category = category::TRIGGER; // 如 "next_level"、"win" 等触发区域
+
+        auto object_category = getCollisionBits(object_json, "category");
+        auto category_bits = object_category ? object_category : getCollisionBits(tile_json, "category");
+        cc->setCategory(category_bits.value_or(default_category));
+
+        // 根据类别推导默认掩码：SOLID 之间无需检测；敌人、道具、危险物体和触发区域只关心玩家（以及会推开它们的 SOLID 物体）
+        std::uint32_t default_mask = category::ALL;
+        if (cc->getCategory() == category::SOLID)
+            default_mask = category::ALL & ~category::SOLID;
+        else if (cc->getCategory() & (category::ENEMY | category::ITEM | category::HAZARD | category::TRIGGER))
+            default_mask = category::DEFAULT | category::SOLID | category::PLAYER;
+
+        auto object_mask = getCollisionBits(object_json, "mask");
+        auto mask_bits = object_mask ? object_mask : getCollisionBits(tile_json, "mask");
+        cc->setMask(mask_bits.value_or(default_mask));
+        spdlog::trace("对象 '{}' 的碰撞类别: {:#x}, 掩码: {:#x}", game_object.getName(), cc->getCategory(), cc->getMask());
+    }
+
+    void LevelLoader::setupBodyType(engine::object::GameObject &game_object, const nlohmann::json &object_json, const nlohmann::json &tile_json)
+    {
+        auto *pc = game_object.getComponent<engine::component::PhysicsComponent>();
+        if (!pc)
+        {
+            return;
+        }
+
+        // 根据标签推导默认类型：不会主动移动的对象设为静态，不参与积分和瓦片碰撞
+        auto tag = game_object.getTag();
+        auto body_type = engine::physics::BodyType::DYNAMIC;
+        if (tag == "solid" || tag == "item" || tag == "hazard" || !game_object.getComponent<engine::component::SpriteComponent>())
+        {
+            body_type = engine::physics::BodyType::STATIC;
+        }
+
+        auto type_name = getTileProperty<std::string>(object_json, "body_type");
+        if (!type_name)
+        {
+            type_name = getTileProperty<std::string>(tile_json, "body_type");
+        }
+        if (type_name)
+        {
+            if (type_name.value() == "dynamic")
+                body_type = engine::physics::BodyType::DYNAMIC;
+            else if (type_name.value() == "kinematic")
+                body_type = engine::physics::BodyType::KINEMATIC;
+            else if (type_name.value() == "static")
+                body_type = engine::physics::BodyType::STATIC;
+            else
+                spdlog::warn("对象 '{}' 的物体类型 '{}' 无效，使用默认值。", game_object.getName(), type_name.value());
+        }
+        pc->setBodyType(body_type);
+    }
+
+    std::optional<std::uint32_t> LevelLoader::getCollisionBits(const nlohmann::json &json, std::string_view property_name)
+    {
+        if (!json.contains("properties"))
+        {
+            return std::nullopt;
+        }
+        for (const auto &property : json["properties"])
+        {
+            if (!property.contains("name") || property["name"] != std::string(property_name) || !property.contains("value"))
+            {
+                continue;
+            }
+            const auto &value = property["value"];
+            // 整数形式：直接作为位掩码
+            if (value.is_number_integer())
+            {
+                return static_cast<std::uint32_t>(value.get<std::int64_t>());
+            }
+            if (!value.is_string())
+            {
+                spdlog::warn("碰撞属性 '{}' 的类型无效。", property_name);
+                return std::nullopt;
+            }
+            // 字符串形式：以 '|' 分隔的类别名称
+            static const std::map<std::string, std::uint32_t, std::less<>> category_names = {
+                {"none", engine::physics::category::NONE},
+                {"default", engine::physics::category::DEFAULT},
+                {"solid", engine::physics::category::SOLID},
+                {"player", engine::physics::category::PLAYER},
+                {"enemy", engine::physics::category::ENEMY},
+                {"item", engine::physics::category::ITEM},
+                {"hazard", engine::physics::category::HAZARD},
+                {"trigger", engine::physics::category::TRIGGER},
+                {"all", engine::physics::category::ALL},
+            };
+            std::uint32_t bits = 0;
+            std::string_view names = value.get_ref<const std::string &>();
+            while (!names.empty())
+            {
+                auto pos = names.find('|');
+                auto name = names.substr(0, pos);
+                names = (pos == std::string_view::npos) ? std::string_view{} : names.substr(pos + 1);
+                // 去除首尾空格
+                while (!name.empty() && name.front() == ' ')
+                    name.remove_prefix(1);
+                while (!name.empty() && name.back() == ' ')
+                    name.remove_suffix(1);
+                if (name.empty())
+                    continue;
+                if (auto it = category_names.find(name); it != category_names.end())
+                {
+                    bits |= it->second;
+                }
+                else
+                {
+                    spdlog::warn("未知的碰撞类别名称 '{}'，已忽略。", name);
+                }
+            }
+            return bits;
+        }
+        return std::nullopt;
+    }
+
     std::optional<engine::utils::Rect> LevelLoader::getColliderRect(const nlohmann::json &tile_json)
     {
         if (!tile_json.contains("objectgroup"))
@@ -487,6 +659,92 @@ namespace engine::scene
         return std::nullopt; // 如果没找到碰撞器，则返回空
     }
 
+    std::unique_ptr<engine::physics::Collider> LevelLoader::createShapeCollider(const nlohmann::json &object_json, glm::vec2 &offset)
+    {
+        constexpr int ARC_SEGMENTS = 8; // 旋转的椭圆/胶囊体转换为多边形时，每个半圆弧的分段数
+        offset = {0.0f, 0.0f};
+        auto size = glm::vec2(object_json.value("width", 0.0f), object_json.value("height", 0.0f));
+        auto rotation = object_json.value("rotation", 0.0f);
+        auto is_ellipse = object_json.value("ellipse", false);
+        auto is_capsule = object_json.value("capsule", false); // Tiled 1.11 新增的胶囊体对象
+
+        std::vector<glm::vec2> outline; // 多边形轮廓顶点（相对于对象坐标）
+        if (object_json.contains("polygon") && object_json["polygon"].is_array())
+        {
+            for (const auto &point : object_json["polygon"])
+            {
+                outline.emplace_back(point.value("x", 0.0f), point.value("y", 0.0f));
+            }
+        }
+        else if (size.x <= 0.0f || size.y <= 0.0f)
+        {
+            return nullptr;
+        }
+        else if (rotation == 0.0f)
+        {
+            // 没有旋转时直接使用对应的碰撞器，包围盒左上角就是对象坐标
+            if (is_ellipse && size.x == size.y)
+                return std::make_unique<engine::physics::CircleCollider>(0.5f * size.x);
+            if (is_ellipse)
+                return std::make_unique<engine::physics::EllipseCollider>(size);
+            if (is_capsule)
+                return std::make_unique<engine::physics::CapsuleCollider>(size);
+            return std::make_unique<engine::physics::AABBCollider>(size);
+        }
+        else if (is_ellipse)
+        {
+            for (int i = 0; i < 2 * ARC_SEGMENTS; ++i)
+            {
+                auto angle = std::numbers::pi_v<float> * i / ARC_SEGMENTS;
+                outline.push_back(0.5f * size + 0.5f * size * glm::vec2(std::cos(angle), std::sin(angle)));
+            }
+        }
+        else if (is_capsule)
+        {
+            // 两个半圆弧：横向胶囊体为右、左两端，纵向胶囊体为下、上两端
+            auto radius = 0.5f * std::min(size.x, size.y);
+            auto horizontal = size.x >= size.y;
+            glm::vec2 centers[2] = {horizontal ? glm::vec2(size.x - radius, radius) : glm::vec2(radius, size.y - radius),
+                                    glm::vec2(radius, radius)};
+            auto start_angle = horizontal ? -0.5f * std::numbers::pi_v<float> : 0.0f;
+            for (int arc = 0; arc < 2; ++arc)
+            {
+                for (int i = 0; i <= ARC_SEGMENTS; ++i)
+                {
+                    auto angle = start_angle + std::numbers::pi_v<float> * (arc + static_cast<float>(i) / ARC_SEGMENTS);
+                    outline.push_back(centers[arc] + radius * glm::vec2(std::cos(angle), std::sin(angle)));
+                }
+            }
+        }
+        else
+        {
+            outline = {{0.0f, 0.0f}, {size.x, 0.0f}, {size.x, size.y}, {0.0f, size.y}};
+        }
+
+        // Tiled 的旋转以对象坐标为中心，顺时针为正 (y轴向下)
+        if (rotation != 0.0f)
+        {
+            auto radians = glm::radians(rotation);
+            auto c = std::cos(radians);
+            auto s = std::sin(radians);
+            for (auto &point : outline)
+            {
+                point = {point.x * c - point.y * s, point.x * s + point.y * c};
+            }
+        }
+        if (outline.size() < 3)
+        {
+            return nullptr;
+        }
+        auto polygon = std::make_unique<engine::physics::PolygonCollider>(std::move(outline));
+        if (polygon->getAABBSize().x <= 0.0f || polygon->getAABBSize().y <= 0.0f)
+        {
+            return nullptr;
+        }
+        offset = polygon->getVertexOrigin();
+        return polygon;
+    }
+
     engine::component::TileType LevelLoader::getTileType(const nlohmann::json &tile_json)
     {
         if (tile_json.contains("properties"))
@@ -532,6 +790,11 @@ namespace engine::scene
                         return engine::component::TileType::NORMAL;
                     }
                 }
+                else if (property.contains("name") && property["name"] == "height_profile")
+                {
+                    // 自定义轮廓的编号在 registerHeightProfiles 中登记，由 getTileInfoByGid 填入 TileInfo
+                    return engine::component::TileType::SLOPE_CUSTOM;
+                }
                 else if (property.contains("name") && property["name"] == "unisolid")
                 {
                     auto is_unisolid = property.value("value", false);
@@ -569,7 +832,7 @@ namespace engine::scene
         return engine::component::TileType::NORMAL;
     }
 
-    engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
+    engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid, glm::vec2 *atlas_offset)
     {
         if (gid == 0)
         {
@@ -608,9 +871,15 @@ namespace engine::scene
                 static_cast<float>(coordinate_y * tile_size_.y),
                 static_cast<float>(tile_size_.x),
                 static_cast<float>(tile_size_.y)};
+            auto offset = remapToAtlas(texture_id, texture_rect);
+            if (atlas_offset)
+            {
+                *atlas_offset = offset;
+            }
             engine::render::Sprite sprite{texture_id, texture_rect};
             auto tile_type = getTileTypeById(tileset, local_id); // 获取瓦片类型（只有瓦片id，还没找具体瓦片json）
-            return engine::component::TileInfo(sprite, tile_type);
+            auto profile_it = height_profiles_.find(gid);
+            return engine::component::TileInfo(sprite, tile_type, profile_it != height_profiles_.end() ? profile_it->second : 0);
         }
         else
         {
@@ -644,9 +913,15 @@ namespace engine::scene
                                               static_cast<float>(tile_json.value("y", 0)),
                                               static_cast<float>(tile_json.value("width", image_width)), // 如果未设置，则使用图片尺寸
                                               static_cast<float>(tile_json.value("height", image_height))};
+                    auto offset = remapToAtlas(texture_id, texture_rect);
+                    if (atlas_offset)
+                    {
+                        *atlas_offset = offset;
+                    }
                     engine::render::Sprite sprite{texture_id, texture_rect};
                     auto tile_type = getTileType(tile_json); // 获取瓦片类型（已经有具体瓦片json了）
-                    return engine::component::TileInfo(sprite, tile_type);
+                    auto profile_it = height_profiles_.find(gid);
+                    return engine::component::TileInfo(sprite, tile_type, profile_it != height_profiles_.end() ? profile_it->second : 0);
                 }
             }
         }
@@ -711,6 +986,105 @@ namespace engine::scene
         spdlog::info("Tileset 文件 '{}' 加载完成，firstgid: {}", tileset_path, first_gid);
     }
 
+    void LevelLoader::registerHeightProfiles(int first_gid, engine::physics::HeightProfileTable &table)
+    {
+        auto tileset_it = tileset_data_.find(first_gid);
+        if (tileset_it == tileset_data_.end() || !tileset_it->second.contains("tiles"))
+        {
+            return;
+        }
+        for (const auto &tile_json : tileset_it->second["tiles"])
+        {
+            auto profile_str = getTileProperty<std::string>(tile_json, "height_profile");
+            if (!profile_str)
+            {
+                continue;
+            }
+            // 解析以逗号分隔的高度比例
+            std::vector<float> keypoints;
+            const char *cursor = profile_str->c_str();
+            while (*cursor != '\0')
+            {
+                char *next = nullptr;
+                auto value = std::strtof(cursor, &next);
+                if (next == cursor)
+                { // 无法解析为数字，整个属性作废
+                    keypoints.clear();
+                    break;
+                }
+                keypoints.push_back(value);
+                cursor = next;
+                while (*cursor == ' ' || *cursor == ',')
+                    ++cursor;
+            }
+            auto gid = first_gid + tile_json.value("id", 0);
+            auto profile = table.addProfile(std::move(keypoints));
+            if (profile == engine::physics::HeightProfileTable::NONE)
+            {
+                spdlog::error("gid为 {} 的瓦片高度轮廓 '{}' 无效，将按平地处理。", gid, *profile_str);
+                continue;
+            }
+            height_profiles_[gid] = profile;
+        }
+    }
+
+    void LevelLoader::buildTextureAtlas(const nlohmann::json &map_json, engine::resource::ResourceManager &resource_manager)
+    {
+        atlas_ = nullptr;
+        if (!getTileProperty<bool>(map_json, "texture_atlas").value_or(true))
+        {
+            spdlog::info("地图 '{}' 未启用纹理图集。", map_path_);
+            return;
+        }
+
+        // 收集所有 tileset 引用的图片（单一图片或每个瓦片的图片）
+        std::vector<std::string> image_paths;
+        for (const auto &[first_gid, tileset] : tileset_data_)
+        {
+            std::string file_path = tileset.value("file_path", "");
+            if (tileset.contains("image"))
+            {
+                image_paths.push_back(resolvePath(tileset["image"].get<std::string>(), file_path));
+            }
+            else if (tileset.contains("tiles"))
+            {
+                for (const auto &tile_json : tileset["tiles"])
+                {
+                    if (tile_json.contains("image"))
+                    {
+                        image_paths.push_back(resolvePath(tile_json["image"].get<std::string>(), file_path));
+                    }
+                }
+            }
+        }
+        std::sort(image_paths.begin(), image_paths.end());
+        image_paths.erase(std::unique(image_paths.begin(), image_paths.end()), image_paths.end());
+        if (image_paths.empty())
+        {
+            return;
+        }
+
+        // 图集以地图路径命名，重新加载同一关卡时直接复用
+        atlas_ = resource_manager.buildTextureAtlas(map_path_, image_paths);
+    }
+
+    glm::vec2 LevelLoader::remapToAtlas(std::string &texture_id, SDL_FRect &texture_rect) const
+    {
+        if (!atlas_)
+        {
+            return glm::vec2(0.0f);
+        }
+        const auto *region = atlas_->findRegion(texture_id);
+        if (!region)
+        { // 没有打包的图片（如尺寸超过图集页面）保持使用原始纹理
+            return glm::vec2(0.0f);
+        }
+        texture_id = region->texture_id;
+        texture_rect.x += region->offset.x;
+        texture_rect.y += region->offset.y;
+        return region->offset;
+    }
+
     std::string LevelLoader::resolvePath(std::string_view relative_path, std::string_view file_path)
     {
         try
@@ -2,8 +2,11 @@
 #include <string>
 #include <glm/vec2.hpp>
 #include <nlohmann/json.hpp>
+#include <SDL3/SDL_rect.h>
 #include <map>
+#include <memory>
 #include <optional>
+#include <cstdint>
 
 #include "../utils/math.h"
 
@@ -15,16 +18,36 @@ namespace engine::component
     enum class TileType;
 }
 
+namespace engine::object
+{
+    class GameObject;
+}
+
+namespace engine::resource
+{
+    class ResourceManager;
+    class TextureAtlas;
+}
+
+namespace engine::physics
+{
+    class Collider;
+    class HeightProfileTable;
+}
+
 namespace engine::scene
 {
     class Scene;
 
     class LevelLoader final
     {
-        std::string map_path_;                       ///< @brief 地图路径（拼接路径时需要）
-        glm::ivec2 map_size_;                        ///< @brief 地图尺寸(瓦片数量)
-        glm::ivec2 tile_size_;                       ///< @brief 瓦片尺寸(像素)
-        std::map<int, nlohmann::json> tileset_data_; ///< @brief firstgid -> 瓦片集数据
+        std::string map_path_;                                  ///< @brief 地图路径（拼接路径时需要）
+        glm::ivec2 map_size_;                                   ///< @brief 地图尺寸(瓦片数量)
+        glm::ivec2 tile_size_;                                  ///< @brief 瓦片尺寸(像素)
+        std::map<int, nlohmann::json> tileset_data_;            ///< @brief firstgid -> 瓦片集数据
+        std::map<int, std::uint8_t> height_profiles_;           ///< @brief gid -> 自定义斜坡高度轮廓编号
+        const engine::resource::TextureAtlas *atlas_ = nullptr; ///< @brief 本关卡瓦片集图片打包成的图集（为空时使用原始图片）
+        int render_layer_ = 0;                                  ///< @brief 正在加载的图层的渲染层（Tiled 图层序号）
 
     public:
         LevelLoader() = default;
@@ -41,8 +64,10 @@ namespace engine::scene
          * @param anim_json 动画json数据（自定义）
          * @param ac AnimationComponent 指针（动画添加到此组件）
          * @param sprite_size 每一帧动画的尺寸
+         * @param texture_offset 图片在纹理中的偏移（图片被打包进图集时不为0）
          */
-        void addAnimation(const nlohmann::json &anim_json, engine::component::AnimationComponent *ac, const glm::vec2 &sprite_size);
+        void addAnimation(const nlohmann::json &anim_json, engine::component::AnimationComponent *ac, const glm::vec2 &sprite_size,
+                          const glm::vec2 &texture_offset = glm::vec2(0.0f));
 
         /**
          * @brief 添加音效到指定的 AudioComponent。
@@ -86,6 +111,48 @@ namespace engine::scene
          */
         std::optional<engine::utils::Rect> getColliderRect(const nlohmann::json &tile_json);
 
+        /**
+         * @brief 根据自定义形状对象创建碰撞器。
+         *
+         * 矩形、椭圆（宽高相等时为圆形）和胶囊体创建对应的碰撞器，多边形创建凸多边形碰撞器（非凸时取凸包）。
+         * 物理引擎不使用 Transform 的旋转，因此有旋转的形状会把旋转应用到顶点上，转换为多边形碰撞器。
+         * @param object_json 对象json数据
+         * @param offset 输出：碰撞器包围盒左上角相对于对象坐标的偏移
+         * @return 碰撞器，点对象或尺寸无效的形状返回 nullptr
+         */
+        std::unique_ptr<engine::physics::Collider> createShapeCollider(const nlohmann::json &object_json, glm::vec2 &offset);
+
+        /**
+         * @brief 根据 Tiled 属性设置对象碰撞器的类别位和掩码。
+         *
+         * 优先读取对象自身的 "category" / "mask" 属性，其次读取瓦片的属性；
+         * 属性可以是整数，也可以是以 '|' 分隔的类别名称（如 "player|solid"）。
+         * 都没有设置时，根据对象标签推导默认值。
+         * @param game_object 已添加碰撞组件的游戏对象（没有碰撞组件则不做处理）。
+         * @param object_json 对象json数据
+         * @param tile_json 瓦片json数据（自定义形状对象与 object_json 相同）
+         */
+        void setupCollisionFilter(engine::object::GameObject &game_object, const nlohmann::json &object_json, const nlohmann::json &tile_json);
+
+        /**
+         * @brief 读取碰撞类别位属性
+         * @param json 对象或瓦片json数据
+         * @param property_name 属性名称 ("category" 或 "mask")
+         * @return 类别位，如果属性不存在或无法解析则返回 std::nullopt
+         */
+        std::optional<std::uint32_t> getCollisionBits(const nlohmann::json &json, std::string_view property_name);
+
+        /**
+         * @brief 根据 Tiled 属性设置对象物理组件的物体类型。
+         *
+         * 优先读取对象自身的 "body_type" 属性，其次读取瓦片的属性，取值为 "dynamic" / "kinematic" / "static"。
+         * 都没有设置时，SOLID、道具、危险物体和自定义形状默认为静态，其它对象默认为动态。
+         * @param game_object 游戏对象（没有物理组件则不做处理）。
+         * @param object_json 对象json数据
+         * @param tile_json 瓦片json数据（自定义形状对象与 object_json 相同）
+         */
+        void setupBodyType(engine::object::GameObject &game_object, const nlohmann::json &object_json, const nlohmann::json &tile_json);
+
         /**
          * @brief 根据瓦片json对象获取瓦片类型
          * @param tile_json 瓦片json数据
@@ -103,10 +170,12 @@ namespace engine::scene
 
         /**
          * @brief 根据全局 ID 获取瓦片信息。
+         * 瓦片图片已被打包进图集时，Sprite 的纹理和源矩形指向图集。
          * @param gid 全局 ID。
+         * @param atlas_offset 输出（可为空）：图片在图集中的偏移，未使用图集时为 (0,0)。
          * @return engine::component::TileInfo 瓦片信息。
          */
-        engine::component::TileInfo getTileInfoByGid(int gid);
+        engine::component::TileInfo getTileInfoByGid(int gid, glm::vec2 *atlas_offset = nullptr);
 
         /**
          * @brief 根据全局 ID 获取瓦片json对象 (用于对象层获取瓦片信息)
@@ -122,6 +191,33 @@ namespace engine::scene
          */
         void loadTileset(std::string_view tileset_path, int first_gid);
 
+        /**
+         * @brief 把 tileset 中瓦片的 "height_profile" 属性注册为自定义斜坡高度轮廓。
+         *
+         * 属性值为以逗号分隔的高度比例（从瓦片下侧起算，如 "0,0.3,0.55,0.75,0.9,1"），关键点在瓦片宽度上均匀分布。
+         * @param first_gid 此 tileset 的第一个全局 ID（tileset 需已通过 loadTileset 加载）。
+         * @param table 物理引擎的高度轮廓表。
+         */
+        void registerHeightProfiles(int first_gid, engine::physics::HeightProfileTable &table);
+
+        /**
+         * @brief 把已加载 tileset 引用的所有图片打包成图集（由 ResourceManager 构建并缓存）。
+         *
+         * 图片层不参与打包：视差背景按整张纹理平铺绘制，无法使用图集中的子区域。
+         * 地图属性 "texture_atlas" 为 false 时不使用图集。
+         * @param map_json 地图json数据
+         * @param resource_manager 资源管理器
+         */
+        void buildTextureAtlas(const nlohmann::json &map_json, engine::resource::ResourceManager &resource_manager);
+
+        /**
+         * @brief 若图片已被打包进图集，把纹理 ID 和源矩形改写为图集中的位置
+         * @param texture_id 纹理 ID（图片路径）
+         * @param texture_rect 图片内的源矩形
+         * @return 图片在图集中的偏移，未打包时返回 (0,0)
+         */
+        glm::vec2 remapToAtlas(std::string &texture_id, SDL_FRect &texture_rect) const;
+
         /**
          * @brief 解析图片路径，合并地图路径和相对路径。例如：
          * 1. 文件路径："assets/maps/level1.tmj"
@@ -1,9 +1,11 @@
 #include "scene.h"
 #include "scene_manager.h"
 #include "../object/game_object.h"
+#include "../component/transform_component.h"
 #include "../core/context.h"
 #include "../core/game_state.h"
 #include "../render/camera.h"
+#include "../render/renderer.h"
 #include "../ui/ui_manager.h"
 #include "../physics/physics_engine.h"
 #include <algorithm> // for std::remove_if
@@ -35,6 +37,8 @@ namespace engine::scene
         {
             return;
         }
+        // 记录上一状态，用于固定步长模式下的渲染插值
+        storePreviousTransforms();
         if (context_.getGameState().isPlaying())
         {
             // 先更新物理引擎
@@ -64,20 +68,38 @@ namespace engine::scene
         processPendingAdditions(); // 处理待添加（延时添加）的游戏对象
     }
 
+    void Scene::storePreviousTransforms()
+    {
+        context_.getCamera().storePreviousPosition();
+        for (const auto &obj : game_objects_)
+        {
+            if (!obj)
+                continue;
+            if (auto *tc = obj->getTransform(); tc)
+            {
+                tc->storePreviousPosition();
+            }
+        }
+    }
+
     void Scene::render()
     {
         if (!is_initialized_)
         {
             return;
         }
-        // 渲染所有游戏对象
+        // 渲染所有游戏对象（世界绘制按对象的渲染层提交到渲染队列）
+        auto &renderer = context_.getRenderer();
         for (const auto &obj : game_objects_)
         {
             if (obj)
             {
+                renderer.setRenderLayer(obj->getRenderLayer());
                 obj->render(context_);
             }
         }
+        // 排序并提交本帧的世界绘制，之后的 UI 绘制在其上方
+        renderer.flush();
 
         // 渲染UI管理器内容
         ui_manager_->render(context_);
@@ -130,6 +152,7 @@ namespace engine::scene
             }
         }
         game_objects_.clear();
+        top_render_layer_ = 0;
 
         is_initialized_ = false; // 清理完成后，设置场景为未初始化
         spdlog::trace("场景 '{}' 清理完成。", scene_name_);
@@ -139,6 +162,12 @@ namespace engine::scene
     {
         if (game_object)
         {
+            // 运行时创建的对象（如特效）没有指定渲染层时放在最高层，与之前追加到末尾的绘制顺序一致
+            if (game_object->getRenderLayer() < 0)
+            {
+                game_object->setRenderLayer(top_render_layer_);
+            }
+            top_render_layer_ = std::max(top_render_layer_, game_object->getRenderLayer());
             game_objects_.push_back(std::move(game_object));
         }
         else
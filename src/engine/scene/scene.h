@@ -38,6 +38,7 @@ namespace engine::scene
         bool is_initialized_ = false;                                                ///< @brief 场景是否已初始化(非当前场景很可能未被删除，因此需要初始化标志避免重复初始化)
         std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;      ///< @brief 场景中的游戏对象
         std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_; ///< @brief 待添加的游戏对象（延时添加）
+        int top_render_layer_ = 0;                                                   ///< @brief 场景中最高的渲染层（未指定渲染层的对象使用此层）
 
     public:
         /**
@@ -83,6 +84,9 @@ namespace engine::scene
         /// @brief 根据名称查找游戏对象（返回找到的第一个对象）。
         engine::object::GameObject *findGameObjectByName(std::string name) const;
 
+        /// @brief 记录相机和所有对象的当前位置，作为渲染插值的上一状态（每次更新开始时调用）
+        void storePreviousTransforms();
+
         // getters and setters
         void setName(std::string name) { scene_name_ = name; }                   ///< @brief 设置场景名称
         std::string getName() const { return scene_name_; }                      ///< @brief 获取场景名称
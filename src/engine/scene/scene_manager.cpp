@@ -135,6 +135,12 @@ namespace engine::scene
             scene->init();
         }
 
+        // 被覆盖的场景不再更新，同步其插值状态，避免渲染时在两个状态之间来回抖动
+        if (auto *current_scene = getCurrentScene(); current_scene)
+        {
+            current_scene->storePreviousTransforms();
+        }
+
         // 将新场景移入栈顶
         scene_stack_.push_back(std::move(scene));
     }
@@ -2,6 +2,7 @@
 #include "../render/renderer.h"
 #include "../render/sprite.h"
 #include "../core/context.h"
+#include "../resource/resource_manager.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::ui
@@ -29,6 +30,12 @@ namespace engine::ui
             return; // 如果不可见或没有分配纹理则不渲染
         }
 
+        // 首次绘制（或更换纹理后）解析纹理句柄
+        if (!sprite_.getTextureHandle().isValid())
+        {
+            sprite_.setTextureHandle(context.getResourceManager().getTextureHandle(sprite_.getTextureId()));
+        }
+
         // 渲染自身
         auto position = getScreenPosition();
         if (size_.x == 0.0f && size_.y == 0.0f)
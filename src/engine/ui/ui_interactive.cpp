@@ -31,10 +31,12 @@ namespace engine::ui
 
     void UIInteractive::addSprite(std::string_view name, std::unique_ptr<engine::render::Sprite> sprite)
     {
+        // 解析纹理句柄，之后绘制时不再按纹理ID查找
+        sprite->setTextureHandle(context_.getResourceManager().getTextureHandle(sprite->getTextureId()));
         // 可交互UI元素必须有一个size用于交互检测，因此如果参数列表中没有指定，则用图片大小作为size
         if (size_.x == 0.0f && size_.y == 0.0f)
         {
-            size_ = context_.getResourceManager().getTextureSize(sprite->getTextureId());
+            size_ = context_.getResourceManager().getTextureSize(sprite->getTextureHandle());
         }
         // 添加精灵
         sprites_[std::string(name)] = std::move(sprite);
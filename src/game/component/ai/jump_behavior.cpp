@@ -5,6 +5,8 @@
 #include "../../../engine/component/sprite_component.h"
 #include "../../../engine/component/animation_component.h"
 #include "../../../engine/component/audio_component.h"
+#include "../../../engine/component/collider_component.h"
+#include "../../../engine/physics/physics_engine.h"
 #include "../../../engine/object/game_object.h"
 #include <spdlog/spdlog.h>
 
@@ -34,6 +36,11 @@ namespace game::component::ai
         }
     }
 
+    JumpBehavior::JumpBehavior(glm::vec2 jump_vel, float jump_interval)
+        : JumpBehavior(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max(), jump_vel, jump_interval)
+    {
+    }
+
     void JumpBehavior::update(float delta_time, AIComponent &ai_component)
     {
         // 获取必要的组件
@@ -57,7 +64,7 @@ namespace game::component::ai
                 audio_component->playSound("cry", true); // 使用空间音频
             }
             jump_timer_ += delta_time;             // 增加跳跃计时器
-            physics_component->velocity_.x = 0.0f; // 停止水平移动（否则会有惯性）
+            physics_component->setVelocityX(0.0f); // 停止水平移动（否则会有惯性）
 
             if (jump_timer_ >= jump_interval_)
             {                       // 时间到，准备跳跃
@@ -76,7 +83,22 @@ namespace game::component::ai
                     jumping_right_ = true;
                 }
                 auto jump_vel_x = jumping_right_ ? jump_vel_.x : -jump_vel_.x; // 确定水平跳跃方向
-                physics_component->velocity_ = {jump_vel_x, jump_vel_.y};      // 设置速度
+
+                // --- 预测落点，落点下方没有地面（悬崖）则改为反方向跳跃 ---
+                auto *collider_component = ai_component.getColliderComponent();
+                auto *physics_engine = physics_component->getPhysicsEngine();
+                if (collider_component && physics_engine && physics_engine->getGravity().y > 0.0f)
+                {
+                    auto aabb = collider_component->getWorldAABB();
+                    auto flight_time = 2.0f * -jump_vel_.y / physics_engine->getGravity().y; // 回到起跳高度所需的时间
+                    auto landing_x = aabb.position.x + aabb.size.x / 2.0f + jump_vel_x * flight_time;
+                    if (!ai_component.hasGroundBelow({landing_x, aabb.position.y}, aabb.size.y + landing_probe_depth_))
+                    {
+                        jumping_right_ = !jumping_right_;
+                        jump_vel_x = -jump_vel_x;
+                    }
+                }
+                physics_component->setVelocity({jump_vel_x, jump_vel_.y});     // 设置速度
                 animation_component->playAnimation("jump");                    // 播放跳跃动画
                 sprite_component->setFlipped(jumping_right_);                  // 更新精灵翻转
             }
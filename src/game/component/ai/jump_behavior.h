@@ -1,6 +1,7 @@
 #pragma once
 #include "ai_behavior.h"
 #include <glm/vec2.hpp>
+#include <limits>
 
 namespace game::component::ai
 {
@@ -9,19 +10,21 @@ namespace game::component::ai
      * @brief AI 行为：在指定范围内周期性地跳跃。
      *
      * 在地面时等待，然后向当前方向跳跃。
-     * 撞墙或到达边界时改变下次跳跃方向。
+     * 撞墙或到达边界时改变下次跳跃方向；预测的落点下方没有地面（悬崖）时也会改变方向。
      */
     class JumpBehavior final : public AIBehavior
     {
         friend class game::component::AIComponent;
 
     private:
-        float patrol_min_x_ = 0.0f;                       ///< @brief 巡逻范围的左边界
-        float patrol_max_x_ = 0.0f;                       ///< @brief 巡逻范围的右边界
-        glm::vec2 jump_vel_ = glm::vec2(100.0f, -300.0f); ///< @brief 跳跃速度
-        float jump_interval_ = 2.0f;                      ///< @brief 跳跃间隔时间 (秒)
-        float jump_timer_ = 0.0f;                         ///< @brief 距离下次跳跃的计时器
-        bool jumping_right_ = false;                      ///< @brief 当前是否向右跳跃
+        float patrol_min_x_ = std::numeric_limits<float>::lowest(); ///< @brief 巡逻范围的左边界
+        float patrol_max_x_ = std::numeric_limits<float>::max();    ///< @brief 巡逻范围的右边界
+        glm::vec2 jump_vel_ = glm::vec2(100.0f, -300.0f);           ///< @brief 跳跃速度
+        float jump_interval_ = 2.0f;                                ///< @brief 跳跃间隔时间 (秒)
+        float jump_timer_ = 0.0f;                                   ///< @brief 距离下次跳跃的计时器
+        bool jumping_right_ = false;                                ///< @brief 当前是否向右跳跃
+
+        static constexpr float landing_probe_depth_ = 16.0f; ///< @brief 落点检测时碰撞盒底边以下的检测距离 (像素)
 
     public:
         /**
@@ -32,6 +35,12 @@ namespace game::component::ai
          * @param jump_interval 两次跳跃之间的间隔时间。
          */
         JumpBehavior(float min_x, float max_x, glm::vec2 jump_vel = glm::vec2(100.0f, -300.0f), float jump_interval = 2.0f);
+        /**
+         * @brief 构造函数，不限制巡逻范围，只依靠墙壁和落点检测改变方向。
+         * @param jump_vel 跳跃速度向量 (水平, 垂直)。
+         * @param jump_interval 两次跳跃之间的间隔时间。
+         */
+        explicit JumpBehavior(glm::vec2 jump_vel = glm::vec2(100.0f, -300.0f), float jump_interval = 2.0f);
         ~JumpBehavior() override = default;
 
         // 禁止拷贝和移动
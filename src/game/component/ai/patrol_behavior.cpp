@@ -4,6 +4,7 @@
 #include "../../../engine/component/transform_component.h"
 #include "../../../engine/component/sprite_component.h"
 #include "../../../engine/component/animation_component.h"
+#include "../../../engine/component/collider_component.h"
 #include "../../../engine/object/game_object.h"
 #include <spdlog/spdlog.h>
 
@@ -22,8 +23,18 @@ namespace game::component::ai
         }
     }
 
+    PatrolBehavior::PatrolBehavior(float speed)
+        : move_speed_(speed)
+    {
+    }
+
     void PatrolBehavior::enter(AIComponent &ai_component)
     {
+        // 开始移动 (之后只在转身时修改速度)
+        if (auto *physics_component = ai_component.getPhysicsComponent(); physics_component)
+        {
+            physics_component->setVelocityX(moving_right_ ? move_speed_ : -move_speed_);
+        }
         // 播放动画 (进行 patrol 行为的对象应该有 'walk' 动画)
         if (auto *animation_component = ai_component.getAnimationComponent(); animation_component)
         {
@@ -43,19 +54,29 @@ namespace game::component::ai
             return;
         }
 
-        // --- 检查碰撞和边界 ---
+        // --- 检查碰撞、悬崖边缘和边界 ---
         auto current_x = transform_component->getPosition().x;
 
-        // 撞右墙或到达设定目标则转向左
-        if (physics_component->hasCollidedRight() || current_x >= patrol_max_x_)
+        // 站在地面上时，检测前进方向脚下是否还有地面，没有则说明到达悬崖边缘
+        bool ledge_ahead = false;
+        if (auto *collider_component = ai_component.getColliderComponent(); collider_component && physics_component->hasCollidedBelow())
+        {
+            auto aabb = collider_component->getWorldAABB();
+            auto probe_x = moving_right_ ? aabb.position.x + aabb.size.x + ledge_probe_ahead_ : aabb.position.x - ledge_probe_ahead_;
+            // 从碰撞盒底边上方1像素开始检测，避免起点恰好位于瓦片边界上
+            ledge_ahead = !ai_component.hasGroundBelow({probe_x, aabb.position.y + aabb.size.y - 1.0f}, ledge_probe_depth_ + 1.0f);
+        }
+
+        // 撞右墙、到达右侧悬崖或到达设定目标则转向左
+        if (physics_component->hasCollidedRight() || current_x >= patrol_max_x_ || (moving_right_ && ledge_ahead))
         {
-            physics_component->velocity_.x = -move_speed_;
+            physics_component->setVelocityX(-move_speed_);
             moving_right_ = false;
-            // 撞墙左或到达设定目标则转向右
+            // 撞墙左、到达左侧悬崖或到达设定目标则转向右
         }
-        else if (physics_component->hasCollidedLeft() || current_x <= patrol_min_x_)
+        else if (physics_component->hasCollidedLeft() || current_x <= patrol_min_x_ || (!moving_right_ && ledge_ahead))
         {
-            physics_component->velocity_.x = move_speed_;
+            physics_component->setVelocityX(move_speed_);
             moving_right_ = true;
         }
 
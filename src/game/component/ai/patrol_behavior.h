@@ -1,5 +1,6 @@
 #pragma once
 #include "ai_behavior.h"
+#include <limits>
 
 namespace game::component::ai
 {
@@ -7,17 +8,20 @@ namespace game::component::ai
     /**
      * @brief AI 行为：在指定范围内左右巡逻。
      *
-     * 遇到墙壁或到达巡逻边界时会转身。
+     * 遇到墙壁、悬崖边缘（通过物理引擎射线检测）或到达巡逻边界时会转身。
      */
     class PatrolBehavior final : public AIBehavior
     {
         friend class game::component::AIComponent;
 
     private:
-        float patrol_min_x_ = 0.0f; ///< @brief 巡逻范围的左边界
-        float patrol_max_x_ = 0.0f; ///< @brief 巡逻范围的右边界
-        float move_speed_ = 50.0f;  ///< @brief 移动速度 (像素/秒)
-        bool moving_right_ = false; ///< @brief 当前是否向右移动
+        float patrol_min_x_ = std::numeric_limits<float>::lowest(); ///< @brief 巡逻范围的左边界
+        float patrol_max_x_ = std::numeric_limits<float>::max();    ///< @brief 巡逻范围的右边界
+        float move_speed_ = 50.0f;                                  ///< @brief 移动速度 (像素/秒)
+        bool moving_right_ = false;                                 ///< @brief 当前是否向右移动
+
+        static constexpr float ledge_probe_ahead_ = 2.0f; ///< @brief 悬崖检测点位于碰撞盒前方的距离 (像素)
+        static constexpr float ledge_probe_depth_ = 8.0f; ///< @brief 悬崖检测向下的距离 (像素)
 
     public:
         /**
@@ -27,6 +31,11 @@ namespace game::component::ai
          * @param speed 移动速度。
          */
         PatrolBehavior(float min_x, float max_x, float speed = 50.0f);
+        /**
+         * @brief 构造函数，不限制巡逻范围，只依靠墙壁和悬崖边缘转身。
+         * @param speed 移动速度。
+         */
+        explicit PatrolBehavior(float speed = 50.0f);
         ~PatrolBehavior() override = default;
 
         // 禁止拷贝和移动
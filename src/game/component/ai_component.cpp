@@ -7,6 +7,8 @@
 #include "../../engine/component/animation_component.h"
 #include "../../engine/component/health_component.h"
 #include "../../engine/component/audio_component.h"
+#include "../../engine/component/collider_component.h"
+#include "../../engine/physics/physics_engine.h"
 #include <spdlog/spdlog.h>
 
 namespace game::component
@@ -26,6 +28,7 @@ namespace game::component
         sprite_component_ = owner_->getComponent<engine::component::SpriteComponent>();
         animation_component_ = owner_->getComponent<engine::component::AnimationComponent>();
         audio_component_ = owner_->getComponent<engine::component::AudioComponent>();
+        collider_component_ = owner_->getComponent<engine::component::ColliderComponent>();
 
         // 检查是否所有必需的组件都存在(音频组件并非必须存在)
         if (!transform_component_ || !physics_component_ || !sprite_component_ || !animation_component_)
@@ -57,6 +60,22 @@ namespace game::component
         }
     }
 
+    bool AIComponent::hasGroundBelow(glm::vec2 point, float depth) const
+    {
+        auto *physics_engine = physics_component_ ? physics_component_->getPhysicsEngine() : nullptr;
+        if (!physics_engine)
+        {
+            return true; // 无法检测时视为有地面，保持原有行为
+        }
+        engine::physics::RaycastQuery query;
+        query.origin = point;
+        query.direction = {0.0f, 1.0f};
+        query.max_distance = depth;
+        query.object_mask = engine::physics::category::SOLID;
+        query.ignore = owner_;
+        return physics_engine->raycast(query).hit;
+    }
+
     bool AIComponent::takeDamage(int damage)
     {
         bool success = false;
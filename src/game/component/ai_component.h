@@ -2,6 +2,7 @@
 #include "../../engine/component/component.h"
 #include "ai/ai_behavior.h"
 #include <memory>
+#include <glm/vec2.hpp>
 
 namespace game::component::ai
 {
@@ -14,6 +15,7 @@ namespace engine::component
     class SpriteComponent;
     class AnimationComponent;
     class AudioComponent;
+    class ColliderComponent;
 }
 
 namespace game::component
@@ -39,6 +41,7 @@ namespace game::component
         engine::component::SpriteComponent *sprite_component_ = nullptr;
         engine::component::AnimationComponent *animation_component_ = nullptr;
         engine::component::AudioComponent *audio_component_ = nullptr;
+        engine::component::ColliderComponent *collider_component_ = nullptr;
 
     public:
         AIComponent() = default;
@@ -54,12 +57,20 @@ namespace game::component
         bool takeDamage(int damage);                                ///< @brief 处理伤害逻辑，返回是否造成伤害
         bool isAlive() const;                                       ///< @brief 检查对象是否存活
 
+        /**
+         * @brief 检查某点下方一定距离内是否有可站立的地面（SOLID 对象或瓦片），用于检测悬崖边缘。
+         * @param point 检测起点（世界坐标）。
+         * @param depth 向下检测的距离。
+         */
+        bool hasGroundBelow(glm::vec2 point, float depth) const;
+
         // --- Setters and Getters ---
         engine::component::TransformComponent *getTransformComponent() const { return transform_component_; }
         engine::component::PhysicsComponent *getPhysicsComponent() const { return physics_component_; }
         engine::component::SpriteComponent *getSpriteComponent() const { return sprite_component_; }
         engine::component::AnimationComponent *getAnimationComponent() const { return animation_component_; }
         engine::component::AudioComponent *getAudioComponent() const { return audio_component_; }
+        engine::component::ColliderComponent *getColliderComponent() const { return collider_component_; }
 
     private:
         // 核心循环方法
@@ -50,10 +50,10 @@ namespace game::component::state
         auto speed = player_component_->getClimbSpeed();
 
         // 三目运算符嵌套，自左向右执行
-        physics_component->velocity_.y = is_up ? -speed : is_down ? speed
-                                                                  : 0.0f;
-        physics_component->velocity_.x = is_left ? -speed : is_right ? speed
-                                                                     : 0.0f;
+        physics_component->setVelocityY(is_up ? -speed : is_down ? speed
+                                                                   : 0.0f);
+        physics_component->setVelocityX(is_left ? -speed : is_right ? speed
+                                                                      : 0.0f);
 
         // --- 根据是否有按键决定动画播放情况 ---
         (is_up || is_down || is_left || is_right)
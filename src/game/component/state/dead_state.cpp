@@ -16,7 +16,7 @@ namespace game::component::state
 
         // 应用击退力（只向上）
         auto physics_component = player_component_->getPhysicsComponent();
-        physics_component->velocity_ = glm::vec2(0.0f, -200.0f); // 向上击退
+        physics_component->setVelocity(glm::vec2(0.0f, -200.0f)); // 向上击退
 
         // 禁用碰撞(自动掉出屏幕)
         auto collider_component = player_component_->getOwner()->getComponent<engine::component::ColliderComponent>();
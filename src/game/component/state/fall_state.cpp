@@ -37,15 +37,15 @@ namespace game::component::state
         // 下落状态下可以左右移动
         if (input_manager.isActionDown("move_left"))
         {
-            if (physics_component->velocity_.x > 0.0f)
-                physics_component->velocity_.x = 0.0f;
+            if (physics_component->getVelocity().x > 0.0f)
+                physics_component->setVelocityX(0.0f);
             physics_component->addForce({-player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(true);
         }
         else if (input_manager.isActionDown("move_right"))
         {
-            if (physics_component->velocity_.x < 0.0f)
-                physics_component->velocity_.x = 0.0f;
+            if (physics_component->getVelocity().x < 0.0f)
+                physics_component->setVelocityX(0.0f);
             physics_component->addForce({player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(false);
         }
@@ -57,12 +57,12 @@ namespace game::component::state
         // 限制最大速度(水平方向)
         auto physics_component = player_component_->getPhysicsComponent();
         auto max_speed = player_component_->getMaxSpeed();
-        physics_component->velocity_.x = glm::clamp(physics_component->velocity_.x, -max_speed, max_speed);
+        physics_component->setVelocityX(glm::clamp(physics_component->getVelocity().x, -max_speed, max_speed));
 
         // 如果下方有碰撞，则根据水平速度来决定 切换到 IdleState 或 WalkState
         if (physics_component->hasCollidedBelow())
         {
-            if (glm::abs(physics_component->velocity_.x) < 1.0f)
+            if (glm::abs(physics_component->getVelocity().x) < 1.0f)
             {
                 return std::make_unique<IdleState>(player_component_);
             }
@@ -24,7 +24,7 @@ namespace game::component::state
         {
             knockback_velocity.x = -knockback_velocity.x; // 变成向右
         }
-        physics_component->velocity_ = knockback_velocity; // 设置击退速度
+        physics_component->setVelocity(knockback_velocity); // 设置击退速度
 
         if (auto *audio_component = player_component_->getAudioComponent(); audio_component)
         {
@@ -50,7 +50,7 @@ namespace game::component::state
         auto physics_component = player_component_->getPhysicsComponent();
         if (physics_component->hasCollidedBelow())
         {
-            if (glm::abs(physics_component->velocity_.x) < 1.0f)
+            if (glm::abs(physics_component->getVelocity().x) < 1.0f)
             {
                 return std::make_unique<IdleState>(player_component_);
             }
@@ -253,18 +253,16 @@ namespace game::scene
             {
                 if (auto *ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component)
                 {
-                    auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x - 10.0f;
-                    auto x_min = x_max - 90.0f; // 青蛙跳跃范围（右侧 - 10.0f 是为了增加稳定性）
-                    ai_component->setBehavior(std::make_unique<game::component::ai::JumpBehavior>(x_min, x_max));
+                    // 青蛙依靠墙壁和落点检测改变跳跃方向，无需设定范围
+                    ai_component->setBehavior(std::make_unique<game::component::ai::JumpBehavior>());
                 }
             }
             if (game_object->getName() == "opossum")
             {
                 if (auto *ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component)
                 {
-                    auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x;
-                    auto x_min = x_max - 200.0f; // 负鼠巡逻范围
-                    ai_component->setBehavior(std::make_unique<game::component::ai::PatrolBehavior>(x_min, x_max));
+                    // 负鼠在墙壁和悬崖边缘之间巡逻，无需设定范围
+                    ai_component->setBehavior(std::make_unique<game::component::ai::PatrolBehavior>());
                 }
             }
             if (game_object->getTag() == "item")
@@ -299,58 +297,67 @@ namespace game::scene
 
     void GameScene::handleObjectCollisons()
     {
-        // 从物理引擎中获取碰撞对
-        auto collision_pairs = context_.getPhysicsEngine().getCollisionPairs();
-        for (const auto &pair : collision_pairs)
+        const auto &physics_engine = context_.getPhysicsEngine();
+        // 新开始的接触：所有类型都需要处理（道具和触发器只在接触开始时处理一次）
+        for (const auto &pair : physics_engine.getContactEnterEvents())
         {
-            auto *obj1 = pair.first;
-            auto *obj2 = pair.second;
+            handleContact(pair, true);
+        }
+        // 保持的接触：敌人和危险物体需要持续处理（无敌时间结束后仍在接触则再次受伤）
+        for (const auto &pair : physics_engine.getContactStayEvents())
+        {
+            handleContact(pair, false);
+        }
+    }
 
-            // 处理玩家与敌人的碰撞
-            if (obj1->getName() == "player" && obj2->getTag() == "enemy")
-            {
-                playerVSEnemyCollision(obj1, obj2);
-            }
-            else if (obj2->getName() == "player" && obj1->getTag() == "enemy")
-            {
-                playerVSEnemyCollision(obj2, obj1);
-            }
-            // 处理玩家与道具的碰撞
-            else if (obj1->getName() == "player" && obj2->getTag() == "item")
-            {
-                playerVSItemCollision(obj1, obj2);
-            }
-            else if (obj2->getName() == "player" && obj1->getTag() == "item")
-            {
-                playerVSItemCollision(obj2, obj1);
-            }
-            // 处理玩家与"hazard"对象碰撞
-            else if (obj1->getName() == "player" && obj2->getTag() == "hazard")
-            {
-                handlePlayerDamage(1);
-                spdlog::debug("玩家 {} 受到了 HAZARD 对象伤害", obj1->getName());
-            }
-            else if (obj2->getName() == "player" && obj1->getTag() == "hazard")
-            {
-                handlePlayerDamage(1);
-                spdlog::debug("玩家 {} 受到了 HAZARD 对象伤害", obj2->getName());
-            }
+    void GameScene::handleContact(const engine::physics::CollisionPair &pair, bool is_enter)
+    {
+        namespace category = engine::physics::category;
+        // 只处理与玩家有关的碰撞，并统一为 (玩家, 另一方)
+        engine::object::GameObject *player = nullptr;
+        engine::object::GameObject *other = nullptr;
+        std::uint32_t other_category = category::NONE;
+        if (pair.first_category & category::PLAYER)
+        {
+            player = pair.first;
+            other = pair.second;
+            other_category = pair.second_category;
+        }
+        else if (pair.second_category & category::PLAYER)
+        {
+            player = pair.second;
+            other = pair.first;
+            other_category = pair.first_category;
+        }
+        else
+        {
+            return;
+        }
 
+        // 类别可能由多个位组合而成（例如 "enemy|hazard"），因此逐位检测而不是比较整个值
+        if (other_category & category::ENEMY) // 处理玩家与敌人的碰撞
+        {
+            playerVSEnemyCollision(player, other);
+        }
+        else if (other_category & category::ITEM) // 处理玩家与道具的碰撞
+        {
+            if (is_enter)
+                playerVSItemCollision(player, other);
+        }
+        else if (other_category & category::HAZARD) // 处理玩家与"hazard"对象碰撞
+        {
+            handlePlayerDamage(1);
+            spdlog::debug("玩家 {} 受到了 HAZARD 对象伤害", player->getName());
+        }
+        else if ((other_category & category::TRIGGER) && is_enter)
+        {
             // 处理玩家与关底触发器碰撞
-            else if (obj1->getName() == "player" && obj2->getTag() == "next_level")
+            if (other->getTag() == "next_level")
             {
-                toNextLevel(obj2);
-            }
-            else if (obj2->getName() == "player" && obj1->getTag() == "next_level")
-            {
-                toNextLevel(obj1);
+                toNextLevel(other);
             }
             // 处理玩家与结束触发器碰撞
-            else if (obj1->getName() == "player" && obj2->getName() == "win")
-            {
-                showEndScene(true);
-            }
-            else if (obj2->getName() == "player" && obj1->getName() == "win")
+            else if (other->getName() == "win")
             {
                 showEndScene(true);
             }
@@ -423,7 +430,7 @@ namespace game::scene
                 createEffect(enemy_center, enemy->getTag()); // 创建（死亡）特效
             }
             // 玩家跳起效果
-            player->getComponent<engine::component::PhysicsComponent>()->velocity_.y = -300.0f; // 向上跳起
+            player->getComponent<engine::component::PhysicsComponent>()->setVelocityY(-300.0f); // 向上跳起
             // 播放音效 (此音效完全可以放在玩家的音频组件中，这里示例另一种用法：直接用AudioPlayer播放，传入文件路径)
             context_.getAudioPlayer().playSound("assets/audio/punch2a.mp3");
             // 加分
@@ -715,25 +722,25 @@ namespace game::scene
 
         if (input_manager.isActionDown("move_left"))
         {
-            pc->velocity_.x = -100.0f;
+            pc->setVelocityX(-100.0f);
         }
         else
         {
-            pc->velocity_.x *= 0.9f;
+            pc->setVelocityX(pc->getVelocity().x * 0.9f);
         }
 
         if (input_manager.isActionDown("move_right"))
         {
-            pc->velocity_.x = 100.0f;
+            pc->setVelocityX(100.0f);
         }
         else
         {
-            pc->velocity_.x *= 0.9f;
+            pc->setVelocityX(pc->getVelocity().x * 0.9f);
         }
 
         if (input_manager.isActionPressed("jump"))
         {
-            pc->velocity_.y = -400.0f;
+            pc->setVelocityY(-400.0f);
         }
     }
 
@@ -748,25 +755,25 @@ namespace game::scene
 
         if (input_manager.isActionDown("move_left"))
         {
-            pc->velocity_.x = -100.0f;
+            pc->setVelocityX(-100.0f);
         }
         else
         {
-            pc->velocity_.x *= 0.9f;
+            pc->setVelocityX(pc->getVelocity().x * 0.9f);
         }
 
         if (input_manager.isActionDown("move_right"))
         {
-            pc->velocity_.x = 100.0f;
+            pc->setVelocityX(100.0f);
         }
         else
         {
-            pc->velocity_.x *= 0.9f;
+            pc->setVelocityX(pc->getVelocity().x * 0.9f);
         }
 
         if (input_manager.isActionPressed("jump"))
         {
-            pc->velocity_.y = -400.0f;
+            pc->setVelocityY(-400.0f);
         }
     }
 
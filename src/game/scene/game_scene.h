@@ -9,6 +9,11 @@ namespace engine::object
     class GameObject;
 }
 
+namespace engine::physics
+{
+    struct CollisionPair;
+}
+
 namespace game::data
 {
     class SessionData;
@@ -52,6 +57,7 @@ namespace game::scene
         [[nodiscard]] bool initUI();
 
         void handleObjectCollisons();                                                                       ///< @brief 处理游戏对象间的碰撞逻辑（从PhysicsEngine获取信息）
+        void handleContact(const engine::physics::CollisionPair &pair, bool is_enter);                      ///< @brief 处理单个接触事件（is_enter 表示接触刚刚开始）
         void handleTileTriggers();                                                                          ///< @brief 处理瓦片触发事件（从PhysicsEngine获取信息）
         void handlePlayerDamage(int damage);                                                                // 造成伤害
         void playerVSEnemyCollision(engine::object::GameObject *player, engine::object::GameObject *enemy); ///< @brief 玩家与敌人碰撞处理
@@ -10,12 +10,13 @@ void setupInitialScene(engine::scene::SceneManager &scene_manager)
     scene_manager.requestPushScene(std::move(title_scene));
 }
 
-int main(int /*argc*/, char * /*argv*/[])
+int main(int argc, char *argv[])
 {
     spdlog::set_level(spdlog::level::off);
     spdlog::info("游戏开始");
 
     engine::core::GameApp app;
+    app.setCommandLine(argc, argv); // 例如 --renderer=offscreen --frames=600，用于在没有显示器的机器上测量渲染性能
     app.registerSceneSetup(setupInitialScene);
     app.run();
     return 0;